@@ -65,6 +65,22 @@ long long __aeabi_llsr(long long x, int n) __attribute__((const));
  */
 long long __aeabi_lasr(long long x, int n) __attribute__((const));
 
+/**
+ * Signed 64-bit comparison
+ * @param a
+ * @param b
+ * @return -1 if a < b, 0 if a == b, 1 if a > b
+ */
+int __aeabi_lcmp(long long a, long long b) __attribute__((const));
+
+/**
+ * Unsigned 64-bit comparison
+ * @param a
+ * @param b
+ * @return -1 if a < b, 0 if a == b, 1 if a > b
+ */
+int __aeabi_ulcmp(unsigned long long a, unsigned long long b) __attribute__((const));
+
 /**
  * Signed 32-bit division
  * @param numerator
@@ -97,6 +113,300 @@ int __attribute__((vector_size(sizeof(int) * 2))) __aeabi_idivmod(int numerator,
  */
 unsigned int __attribute__((vector_size(sizeof(unsigned int) * 2))) __aeabi_uidivmod(unsigned int numerator, unsigned int denominator) __attribute__((const));
 
+/**
+ * Single precision addition, rounded to nearest even
+ * @param a
+ * @param b
+ * @return a + b
+ */
+float __aeabi_fadd(float a, float b) __attribute__((const));
+
+/**
+ * Single precision subtraction, rounded to nearest even
+ * @param a
+ * @param b
+ * @return a - b
+ */
+float __aeabi_fsub(float a, float b) __attribute__((const));
+
+/**
+ * Single precision reverse subtraction, rounded to nearest even
+ * @param a
+ * @param b
+ * @return b - a
+ */
+float __aeabi_frsub(float a, float b) __attribute__((const));
+
+/**
+ * Single precision multiplication, rounded to nearest even
+ * @param a
+ * @param b
+ * @return a * b
+ */
+float __aeabi_fmul(float a, float b) __attribute__((const));
+
+/**
+ * Single precision division, rounded to nearest even
+ * @param numerator
+ * @param denominator
+ * @return numerator / denominator
+ */
+float __aeabi_fdiv(float numerator, float denominator) __attribute__((const));
+
+/**
+ * Signed integer to single precision, rounded to nearest even
+ * @param x
+ * @return (float) x
+ */
+float __aeabi_i2f(int x) __attribute__((const));
+
+/**
+ * Unsigned integer to single precision, rounded to nearest even
+ * @param x
+ * @return (float) x
+ */
+float __aeabi_ui2f(unsigned int x) __attribute__((const));
+
+/**
+ * Signed 64-bit integer to single precision, rounded to nearest even
+ * @param x
+ * @return (float) x
+ */
+float __aeabi_l2f(long long x) __attribute__((const));
+
+/**
+ * Unsigned 64-bit integer to single precision, rounded to nearest even
+ * @param x
+ * @return (float) x
+ */
+float __aeabi_ul2f(unsigned long long x) __attribute__((const));
+
+/**
+ * Single precision to signed integer, rounded towards zero
+ * Out of range values saturate, NaN converts to 0
+ * @param x
+ * @return (int) x
+ */
+int __aeabi_f2iz(float x) __attribute__((const));
+
+/**
+ * Single precision to unsigned integer, rounded towards zero
+ * Negative values convert to 0, large values saturate, NaN converts to 0
+ * @param x
+ * @return (unsigned int) x
+ */
+unsigned int __aeabi_f2uiz(float x) __attribute__((const));
+
+/**
+ * Single precision equality
+ * @param a
+ * @param b
+ * @return 1 if a == b, otherwise 0
+ */
+int __aeabi_fcmpeq(float a, float b) __attribute__((const));
+
+/**
+ * Single precision less than
+ * @param a
+ * @param b
+ * @return 1 if a < b, otherwise 0
+ */
+int __aeabi_fcmplt(float a, float b) __attribute__((const));
+
+/**
+ * Single precision less than or equal
+ * @param a
+ * @param b
+ * @return 1 if a <= b, otherwise 0
+ */
+int __aeabi_fcmple(float a, float b) __attribute__((const));
+
+/**
+ * Single precision greater than or equal
+ * @param a
+ * @param b
+ * @return 1 if a >= b, otherwise 0
+ */
+int __aeabi_fcmpge(float a, float b) __attribute__((const));
+
+/**
+ * Single precision greater than
+ * @param a
+ * @param b
+ * @return 1 if a > b, otherwise 0
+ */
+int __aeabi_fcmpgt(float a, float b) __attribute__((const));
+
+/**
+ * Single precision unordered comparison
+ * @param a
+ * @param b
+ * @return 1 if either a or b is NaN, otherwise 0
+ */
+int __aeabi_fcmpun(float a, float b) __attribute__((const));
+
+/**
+ * Double precision addition, rounded to nearest even
+ * @param a
+ * @param b
+ * @return a + b
+ */
+double __aeabi_dadd(double a, double b) __attribute__((const));
+
+/**
+ * Double precision subtraction, rounded to nearest even
+ * @param a
+ * @param b
+ * @return a - b
+ */
+double __aeabi_dsub(double a, double b) __attribute__((const));
+
+/**
+ * Double precision reverse subtraction, rounded to nearest even
+ * @param a
+ * @param b
+ * @return b - a
+ */
+double __aeabi_drsub(double a, double b) __attribute__((const));
+
+/**
+ * Double precision multiplication, rounded to nearest even
+ * @param a
+ * @param b
+ * @return a * b
+ */
+double __aeabi_dmul(double a, double b) __attribute__((const));
+
+/**
+ * Double precision division, rounded to nearest even
+ * @param numerator
+ * @param denominator
+ * @return numerator / denominator
+ */
+double __aeabi_ddiv(double numerator, double denominator) __attribute__((const));
+
+/**
+ * Signed integer to double precision
+ * @param x
+ * @return (double) x
+ */
+double __aeabi_i2d(int x) __attribute__((const));
+
+/**
+ * Unsigned integer to double precision
+ * @param x
+ * @return (double) x
+ */
+double __aeabi_ui2d(unsigned int x) __attribute__((const));
+
+/**
+ * Signed 64-bit integer to double precision, rounded to nearest even
+ * @param x
+ * @return (double) x
+ */
+double __aeabi_l2d(long long x) __attribute__((const));
+
+/**
+ * Unsigned 64-bit integer to double precision, rounded to nearest even
+ * @param x
+ * @return (double) x
+ */
+double __aeabi_ul2d(unsigned long long x) __attribute__((const));
+
+/**
+ * Double precision to signed integer, rounded towards zero
+ * Out of range values saturate, NaN converts to 0
+ * @param x
+ * @return (int) x
+ */
+int __aeabi_d2iz(double x) __attribute__((const));
+
+/**
+ * Double precision to unsigned integer, rounded towards zero
+ * Negative values convert to 0, large values saturate, NaN converts to 0
+ * @param x
+ * @return (unsigned int) x
+ */
+unsigned int __aeabi_d2uiz(double x) __attribute__((const));
+
+/**
+ * Double precision to signed 64-bit integer, rounded towards zero
+ * Out of range values saturate, NaN converts to 0
+ * @param x
+ * @return (long long) x
+ */
+long long __aeabi_d2lz(double x) __attribute__((const));
+
+/**
+ * Double precision to unsigned 64-bit integer, rounded towards zero
+ * Negative values convert to 0, large values saturate, NaN converts to 0
+ * @param x
+ * @return (unsigned long long) x
+ */
+unsigned long long __aeabi_d2ulz(double x) __attribute__((const));
+
+/**
+ * Single precision to double precision
+ * @param x
+ * @return (double) x
+ */
+double __aeabi_f2d(float x) __attribute__((const));
+
+/**
+ * Double precision to single precision, rounded to nearest even
+ * @param x
+ * @return (float) x
+ */
+float __aeabi_d2f(double x) __attribute__((const));
+
+/**
+ * Double precision equality
+ * @param a
+ * @param b
+ * @return 1 if a == b, otherwise 0
+ */
+int __aeabi_dcmpeq(double a, double b) __attribute__((const));
+
+/**
+ * Double precision less than
+ * @param a
+ * @param b
+ * @return 1 if a < b, otherwise 0
+ */
+int __aeabi_dcmplt(double a, double b) __attribute__((const));
+
+/**
+ * Double precision less than or equal
+ * @param a
+ * @param b
+ * @return 1 if a <= b, otherwise 0
+ */
+int __aeabi_dcmple(double a, double b) __attribute__((const));
+
+/**
+ * Double precision greater than or equal
+ * @param a
+ * @param b
+ * @return 1 if a >= b, otherwise 0
+ */
+int __aeabi_dcmpge(double a, double b) __attribute__((const));
+
+/**
+ * Double precision greater than
+ * @param a
+ * @param b
+ * @return 1 if a > b, otherwise 0
+ */
+int __aeabi_dcmpgt(double a, double b) __attribute__((const));
+
+/**
+ * Double precision unordered comparison
+ * @param a
+ * @param b
+ * @return 1 if either a or b is NaN, otherwise 0
+ */
+int __aeabi_dcmpun(double a, double b) __attribute__((const));
+
 /**
  * Alias of __aeabi_memcpy4
  * @param dest Destination address
@@ -116,6 +426,7 @@ void __aeabi_memcpy4(void* __restrict__ dest, const void* __restrict__ src, size
 
 /**
  * Copies n bytes from src to dest (forward)
+ * Copies involving SRAM are byte-by-byte, and video memory dest is copied without 8-bit writes
  * @param dest Destination address
  * @param src Source address
  * @param n Number of bytes to copy
@@ -194,6 +505,36 @@ void __aeabi_memclr4(void* dest, size_t n) __attribute__((nonnull(1)));
  */
 void __aeabi_memclr(void* dest, size_t n) __attribute__((nonnull(1)));
 
+/**
+ * Reads 4 bytes from an address of any alignment
+ * @param address Source address
+ * @return Value read
+ */
+int __aeabi_uread4(void* address) __attribute__((nonnull(1)));
+
+/**
+ * Writes 4 bytes to an address of any alignment
+ * @param value Value to write
+ * @param address Destination address
+ * @return value
+ */
+int __aeabi_uwrite4(int value, void* address) __attribute__((nonnull(2)));
+
+/**
+ * Reads 8 bytes from an address of any alignment
+ * @param address Source address
+ * @return Value read
+ */
+long long __aeabi_uread8(void* address) __attribute__((nonnull(1)));
+
+/**
+ * Writes 8 bytes to an address of any alignment
+ * @param value Value to write
+ * @param address Destination address
+ * @return value
+ */
+long long __aeabi_uwrite8(long long value, void* address) __attribute__((nonnull(2)));
+
 #ifdef __cplusplus
 }
 #endif
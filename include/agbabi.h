@@ -67,6 +67,22 @@ unsigned long long __attribute__((vector_size(sizeof(unsigned long long) * 2)))
  */
 unsigned long long __attribute__((vector_size(sizeof(unsigned long long) * 2))) __agbabi_unsafe_uluidivmod(unsigned long long numerator, unsigned int denominator) __attribute__((const));
 
+/**
+ * Signed 64-bit / 32-bit -> 64-bit division
+ * @param numerator
+ * @param denominator
+ * @return quotient
+ */
+long long __agbabi_lidiv(long long numerator, int denominator) __attribute__((const));
+
+/**
+ * Signed 64-bit / 32-bit -> 64-bit division and modulo
+ * @param numerator
+ * @param denominator
+ * @return [quotient, remainder]
+ */
+long long __attribute__((vector_size(sizeof(long long) * 2))) __agbabi_lidivmod(long long numerator, int denominator) __attribute__((const));
+
 /**
  * Unsigned 32-bit division and modulo
  * Check for divide by zero is not performed
@@ -76,6 +92,250 @@ unsigned long long __attribute__((vector_size(sizeof(unsigned long long) * 2)))
  */
 unsigned int __attribute__((vector_size(sizeof(unsigned int) * 2))) __agbabi_unsafe_uidivmod(unsigned int numerator, unsigned int denominator) __attribute__((const));
 
+/**
+ * Unsigned 32-bit division of each numerator by one denominator
+ * Check for divide by zero is performed once, before any quotient is written
+ * @param quotients Destination for n quotients, may be the same as numerators
+ * @param numerators
+ * @param denominator
+ * @param n Number of elements
+ */
+void __agbabi_uidiv_array(unsigned int* quotients, const unsigned int* numerators, unsigned int denominator, size_t n);
+
+/**
+ * Unsigned 32-bit modulo of each numerator by one denominator
+ * Check for divide by zero is performed once, before any remainder is written
+ * @param remainders Destination for n remainders, may be the same as numerators
+ * @param numerators
+ * @param denominator
+ * @param n Number of elements
+ */
+void __agbabi_uimod_array(unsigned int* remainders, const unsigned int* numerators, unsigned int denominator, size_t n);
+
+/**
+ * Unsigned 32-bit division of each numerator by its own denominator
+ * A zero denominator stores the result of __aeabi_idiv0 as its quotient
+ * @param quotients Destination for n quotients, may be the same as numerators
+ * @param numerators
+ * @param denominators
+ * @param n Number of elements
+ */
+void __agbabi_uidiv_arrays(unsigned int* quotients, const unsigned int* numerators, const unsigned int* denominators, size_t n);
+
+/**
+ * Signed 32-bit division of each numerator by one denominator
+ * Check for divide by zero is performed once, before any quotient is written
+ * @param quotients Destination for n quotients, may be the same as numerators
+ * @param numerators
+ * @param denominator
+ * @param n Number of elements
+ */
+void __agbabi_idiv_array(int* quotients, const int* numerators, int denominator, size_t n);
+
+/**
+ * Signed 32-bit modulo of each numerator by one denominator
+ * Remainders take the sign of the numerator, as with __aeabi_idivmod
+ * Check for divide by zero is performed once, before any remainder is written
+ * @param remainders Destination for n remainders, may be the same as numerators
+ * @param numerators
+ * @param denominator
+ * @param n Number of elements
+ */
+void __agbabi_imod_array(int* remainders, const int* numerators, int denominator, size_t n);
+
+/**
+ * Signed 32-bit division of each numerator by its own denominator
+ * A zero denominator stores the result of __aeabi_idiv0 as its quotient
+ * @param quotients Destination for n quotients, may be the same as numerators
+ * @param numerators
+ * @param denominators
+ * @param n Number of elements
+ */
+void __agbabi_idiv_arrays(int* quotients, const int* numerators, const int* denominators, size_t n);
+
+/**
+ * Unsigned 32-bit divisor prepared for repeated division
+ * @param magic Reciprocal multiplier, 0 for powers of two
+ * @param more Bits 0-7 are the shift, bit 8 is set when the numerator is added back
+ */
+typedef struct {
+    unsigned int magic;
+    unsigned int more;
+} __agbabi_udiv_t;
+
+/**
+ * Signed 32-bit divisor prepared for repeated division
+ * @param magic Reciprocal multiplier, 0 for powers of two
+ * @param more Bits 0-7 are the shift, bit 8 is set when the numerator is added back, bit 31 is set for a negative divisor
+ */
+typedef struct {
+    int magic;
+    unsigned int more;
+} __agbabi_idiv_t;
+
+/**
+ * Unsigned 32-bit divisor prepared for repeated division of 64-bit numerators
+ * @param magic Reciprocal multiplier, 0 for powers of two
+ * @param more Bits 0-7 are the shift, bit 8 is set when the numerator is added back
+ */
+typedef struct {
+    unsigned long long magic;
+    unsigned int more;
+} __agbabi_uluidiv_t;
+
+/**
+ * Prepares an unsigned 32-bit divisor for __agbabi_udiv_prepared
+ * @param div Pointer to prepared divisor to initialize
+ * @param denominator Must not be zero
+ */
+void __agbabi_udiv_prepare(__agbabi_udiv_t* div, unsigned int denominator) __attribute__((nonnull(1)));
+
+/**
+ * Unsigned 32-bit division by a prepared divisor
+ * Multiplies by a reciprocal rather than dividing
+ * @param numerator
+ * @param div Divisor prepared by __agbabi_udiv_prepare
+ * @return quotient
+ */
+unsigned int __agbabi_udiv_prepared(unsigned int numerator, const __agbabi_udiv_t* div) __attribute__((nonnull(2), pure));
+
+/**
+ * Prepares a signed 32-bit divisor for __agbabi_idiv_prepared
+ * @param div Pointer to prepared divisor to initialize
+ * @param denominator Must not be zero
+ */
+void __agbabi_idiv_prepare(__agbabi_idiv_t* div, int denominator) __attribute__((nonnull(1)));
+
+/**
+ * Signed 32-bit division by a prepared divisor, rounding towards zero
+ * Multiplies by a reciprocal rather than dividing
+ * @param numerator
+ * @param div Divisor prepared by __agbabi_idiv_prepare
+ * @return quotient
+ */
+int __agbabi_idiv_prepared(int numerator, const __agbabi_idiv_t* div) __attribute__((nonnull(2), pure));
+
+/**
+ * Prepares an unsigned 32-bit divisor for __agbabi_uluidiv_prepared
+ * @param div Pointer to prepared divisor to initialize
+ * @param denominator Must not be zero
+ */
+void __agbabi_uluidiv_prepare(__agbabi_uluidiv_t* div, unsigned int denominator) __attribute__((nonnull(1)));
+
+/**
+ * Unsigned 64-bit / 32-bit -> 64-bit division by a prepared divisor
+ * Multiplies by a reciprocal rather than dividing
+ * @param numerator
+ * @param div Divisor prepared by __agbabi_uluidiv_prepare
+ * @return quotient
+ */
+unsigned long long __agbabi_uluidiv_prepared(unsigned long long numerator, const __agbabi_uluidiv_t* div) __attribute__((nonnull(2), pure));
+
+/**
+ * Signed Q16 fixed-point division, (numerator << 16) / denominator
+ * Quotients that do not fit in an int saturate to INT_MAX or INT_MIN
+ * @param numerator
+ * @param denominator
+ * @return quotient
+ */
+int __agbabi_fxdiv16(int numerator, int denominator) __attribute__((const));
+
+/**
+ * Signed Q12 fixed-point division, (numerator << 12) / denominator
+ * Quotients that do not fit in an int saturate to INT_MAX or INT_MIN
+ * @param numerator
+ * @param denominator
+ * @return quotient
+ */
+int __agbabi_fxdiv12(int numerator, int denominator) __attribute__((const));
+
+/**
+ * Signed Q8 fixed-point division, (numerator << 8) / denominator
+ * Quotients that do not fit in an int saturate to INT_MAX or INT_MIN
+ * @param numerator
+ * @param denominator
+ * @return quotient
+ */
+int __agbabi_fxdiv8(int numerator, int denominator) __attribute__((const));
+
+/**
+ * Signed Q16 fixed-point division using a reciprocal estimate refined by Newton-Raphson
+ * Rounds towards zero, up to 2 less in magnitude than __agbabi_fxdiv16
+ * @param numerator
+ * @param denominator
+ * @return quotient
+ */
+int __agbabi_fxdiv16_approx(int numerator, int denominator) __attribute__((const));
+
+/**
+ * Signed Q12 fixed-point division using a reciprocal estimate refined by Newton-Raphson
+ * Rounds towards zero, up to 2 less in magnitude than __agbabi_fxdiv12
+ * @param numerator
+ * @param denominator
+ * @return quotient
+ */
+int __agbabi_fxdiv12_approx(int numerator, int denominator) __attribute__((const));
+
+/**
+ * Signed Q8 fixed-point division using a reciprocal estimate refined by Newton-Raphson
+ * Rounds towards zero, up to 2 less in magnitude than __agbabi_fxdiv8
+ * @param numerator
+ * @param denominator
+ * @return quotient
+ */
+int __agbabi_fxdiv8_approx(int numerator, int denominator) __attribute__((const));
+
+/**
+ * Writes the decimal digits of an unsigned 32-bit integer and a null terminator
+ * Divides by multiplying with reciprocals, two digits per step
+ * @param value
+ * @param buffer Destination for at least 11 characters
+ * @return Pointer to the null terminator
+ */
+char* __agbabi_utoa10(unsigned int value, char* buffer) __attribute__((nonnull(2)));
+
+/**
+ * Writes the decimal digits of a signed 32-bit integer and a null terminator
+ * Divides by multiplying with reciprocals, two digits per step
+ * @param value
+ * @param buffer Destination for at least 12 characters
+ * @return Pointer to the null terminator
+ */
+char* __agbabi_itoa10(int value, char* buffer) __attribute__((nonnull(2)));
+
+/**
+ * Writes the decimal digits of an unsigned 64-bit integer and a null terminator
+ * Does not call __aeabi_uldivmod
+ * @param value
+ * @param buffer Destination for at least 21 characters
+ * @return Pointer to the null terminator
+ */
+char* __agbabi_ulltoa10(unsigned long long value, char* buffer) __attribute__((nonnull(2)));
+
+/**
+ * Writes the lowercase hexadecimal digits of an unsigned 32-bit integer and a null terminator
+ * @param value
+ * @param buffer Destination for at least 9 characters
+ * @return Pointer to the null terminator
+ */
+char* __agbabi_utoa16(unsigned int value, char* buffer) __attribute__((nonnull(2)));
+
+/**
+ * Converts an unsigned 32-bit integer to packed binary-coded decimal
+ * @param value Must be less than 100000000
+ * @return 8 BCD digits, one per nibble
+ */
+unsigned int __agbabi_utobcd(unsigned int value) __attribute__((const));
+
+/**
+ * Copies n bytes from src to dest (forward)
+ * Same as __aeabi_memcpy without the SRAM and video memory checks
+ * @param dest Destination address
+ * @param src Source address
+ * @param n Number of bytes to copy
+ */
+void __agbabi_memcpy(void* __restrict__ dest, const void* __restrict__ src, size_t n) __attribute__((nonnull(1, 2)));
+
 /**
  * Copies n bytes from src to dest (forward)
  * Assumes dest and src are 2-byte aligned
@@ -129,6 +389,53 @@ void __agbabi_fiq_memcpy4x4(void* __restrict__ dest, const void* __restrict__ sr
  */
 void __agbabi_fiq_memcpy4(void* __restrict__ dest, const void* __restrict__ src, size_t n) __attribute__((nonnull(1, 2)));
 
+/**
+ * Copies n bytes from src to dest (backwards) using FIQ mode
+ * Assumes dest and src are 4-byte aligned
+ * @param dest Destination address
+ * @param src Source address
+ * @param n Number of bytes to copy
+ */
+void __agbabi_fiq_rmemcpy4(void* __restrict__ dest, const void* __restrict__ src, size_t n) __attribute__((nonnull(1, 2)));
+
+/**
+ * Safely copies n bytes of src to dest using FIQ mode
+ * Assumes dest and src are 4-byte aligned
+ * @param dest Destination address
+ * @param src Source address
+ * @param n Number of bytes to copy
+ */
+void __agbabi_fiq_memmove4(void* dest, const void* src, size_t n) __attribute__((nonnull(1, 2)));
+
+/**
+ * Set n bytes of dest to (c & 0xff) using FIQ mode
+ * Assumes dest is 4-byte aligned
+ * @param dest Destination address
+ * @param n Number of bytes to set
+ * @param c Value to set
+ */
+void __agbabi_fiq_memset4(void* dest, size_t n, int c) __attribute__((nonnull(1)));
+
+/**
+ * Fills dest with n bytes of c using FIQ mode
+ * Assumes dest is 4-byte aligned
+ * Trailing copy uses the low byte of c
+ * @param dest Destination address
+ * @param n Number of bytes to set
+ * @param c Value to set
+ */
+void __agbabi_fiq_wordset4(void* dest, size_t n, int c) __attribute__((nonnull(1)));
+
+/**
+ * Fills dest with n bytes of c using FIQ mode
+ * Assumes dest is 4-byte aligned
+ * Trailing copy uses the low word of c, and the low byte of c
+ * @param dest Destination address
+ * @param n Number of bytes to set
+ * @param c Value to set
+ */
+void __agbabi_fiq_lwordset4(void* dest, size_t n, long long c) __attribute__((nonnull(1)));
+
 /**
  * Fills dest with n bytes of c
  * Assumes dest is 4-byte aligned
@@ -149,6 +456,128 @@ void __agbabi_lwordset4(void* dest, size_t n, long long c) __attribute__((nonnul
  */
 void __agbabi_wordset4(void* dest, size_t n, int c) __attribute__((nonnull(1)));
 
+/**
+ * Copies n bytes from src to dest (forward) without 8-bit writes
+ * Odd head and tail bytes are merged into their halfword: safe for VRAM, OAM, and palette
+ * @param dest Destination address
+ * @param src Source address
+ * @param n Number of bytes to copy
+ */
+void __agbabi_vram_memcpy(void* __restrict__ dest, const void* __restrict__ src, size_t n) __attribute__((nonnull(1, 2)));
+
+/**
+ * Set n bytes of dest to (c & 0xff) without 8-bit writes
+ * Odd head and tail bytes are merged into their halfword: safe for VRAM, OAM, and palette
+ * @param dest Destination address
+ * @param n Number of bytes to set
+ * @param c Value to set
+ */
+void __agbabi_vram_memset(void* dest, size_t n, int c) __attribute__((nonnull(1)));
+
+/**
+ * Copies n bytes from src to dest (forward) using DMA3
+ * Head and tail bytes are copied with the CPU
+ * Falls back to __aeabi_memcpy for odd-aligned copies, and below 832 bytes (256 bytes when off by a halfword)
+ * @param dest Destination address
+ * @param src Source address
+ * @param n Number of bytes to copy
+ */
+void __agbabi_dma_memcpy(void* __restrict__ dest, const void* __restrict__ src, size_t n) __attribute__((nonnull(1, 2)));
+
+/**
+ * Copies n bytes from src to dest (forward) using 32-bit DMA3
+ * Assumes dest and src are 4-byte aligned
+ * Trailing bytes are copied with the CPU
+ * @param dest Destination address
+ * @param src Source address
+ * @param n Number of bytes to copy
+ */
+void __agbabi_dma_memcpy4(void* __restrict__ dest, const void* __restrict__ src, size_t n) __attribute__((nonnull(1, 2)));
+
+/**
+ * Set n bytes of dest to (c & 0xff)
+ * Always sets with __agbabi_vram_memset, as a DMA fill is slower than the CPU at every size
+ * Use __agbabi_dma_memset4 to fill with DMA3
+ * @param dest Destination address
+ * @param n Number of bytes to set
+ * @param c Value to set
+ */
+void __agbabi_dma_memset(void* dest, size_t n, int c) __attribute__((nonnull(1)));
+
+/**
+ * Set n bytes of dest to (c & 0xff) using 32-bit DMA3
+ * Assumes dest is 4-byte aligned
+ * Trailing bytes are set with the CPU
+ * @param dest Destination address
+ * @param n Number of bytes to set
+ * @param c Value to set
+ */
+void __agbabi_dma_memset4(void* dest, size_t n, int c) __attribute__((nonnull(1)));
+
+/**
+ * DMA queue transfer descriptor
+ * @param src Source address
+ * @param dest Destination address
+ * @param n Number of bytes to copy, must be a multiple of 2
+ * @param channel DMA channel 0-3
+ * @param timing 0 = immediate, 1 = VBlank, 2 = HBlank, 3 = special
+ * @param callback Called from the IRQ handler when the transfer completes, may be NULL
+ */
+typedef struct __agbabi_dma_desc {
+    const void* src;
+    void* dest;
+    size_t n;
+    unsigned char channel;
+    unsigned char timing;
+    void(*callback)(const struct __agbabi_dma_desc* desc);
+} __agbabi_dma_desc_t;
+
+/**
+ * DMA queue counters
+ * @param depth Number of queued descriptors, including the one in flight
+ * @param max_depth Highest depth reached
+ * @param stalls Number of descriptors rejected because the queue was full
+ * @param completed Number of descriptors completed
+ */
+typedef struct {
+    unsigned int depth;
+    unsigned int max_depth;
+    unsigned int stalls;
+    unsigned int completed;
+} __agbabi_dma_queue_stats_t;
+
+/**
+ * Queues count descriptors to be transferred back-to-back
+ * Descriptors are referenced, not copied, and must stay valid until completed
+ * Zero-length descriptors complete without starting DMA
+ * Submission stops at a descriptor with an odd n, src, or dest
+ * Requires __agbabi_irq_user as the IRQ handler
+ * @param desc Array of descriptors
+ * @param count Number of descriptors
+ * @return Number of descriptors queued
+ */
+size_t __agbabi_dma_queue_submit(const __agbabi_dma_desc_t* desc, size_t count) __attribute__((nonnull(1)));
+
+/**
+ * Services the DMA queue
+ * Called by __agbabi_irq_user when linked
+ * @param irqFlags 16-bit mask of the raised flags
+ * @return DMA IRQ flags of drained channels, to be left disabled in REG_IE
+ */
+int __agbabi_dma_queue_irq(int irqFlags);
+
+/**
+ * Check if the DMA queue has transfers pending
+ * @return 0 when the queue is empty
+ */
+int __agbabi_dma_queue_busy(void);
+
+/**
+ * Get the DMA queue counters
+ * @return Counters for tuning queue usage
+ */
+__agbabi_dma_queue_stats_t __agbabi_dma_queue_stats(void);
+
 /**
  * Fixed-point sine approximation
  * @param x 15-bit binary angle measurement
@@ -156,6 +585,37 @@ void __agbabi_wordset4(void* dest, size_t n, int c) __attribute__((nonnull(1)));
  */
 int __agbabi_sin(int x) __attribute__((const));
 
+/**
+ * Fixed-point sine and cosine approximation
+ * @param x 15-bit binary angle measurement
+ * @return [sine, cosine] Q29 signed fixed point between -1 and +1
+ */
+int __attribute__((vector_size(sizeof(int) * 2))) __agbabi_sincos(int x) __attribute__((const));
+
+/**
+ * Fixed-point sine approximation of evenly spaced angles
+ * dest[i] = __agbabi_sin(start + i * step)
+ * @param dest Destination for n Q29 signed fixed point values
+ * @param start 15-bit binary angle measurement of the first value
+ * @param step Angle added for each following value
+ * @param n Number of values
+ */
+void __agbabi_sin_array(int* dest, int start, int step, size_t n) __attribute__((nonnull(1)));
+
+/**
+ * Fifth-order fixed-point sine approximation, max error 9e-5
+ * @param x 15-bit binary angle measurement
+ * @return Q29 signed fixed point between -1 and +1
+ */
+int __agbabi_sin5(int x) __attribute__((const));
+
+/**
+ * Table fixed-point sine approximation with linear interpolation, max error 5e-6
+ * @param x 15-bit binary angle measurement
+ * @return Q29 signed fixed point between -1 and +1
+ */
+int __agbabi_sin_lut(int x) __attribute__((const));
+
 /**
  * Calculates the arc tangent of x, y
  * @param x Q12 signed fixed point coord around circle
@@ -164,6 +624,15 @@ int __agbabi_sin(int x) __attribute__((const));
  */
 unsigned int __agbabi_atan2(int x, int y) __attribute__((const));
 
+/**
+ * Calculates the arc tangent of n x, y pairs, without division
+ * Results are within 1 of __agbabi_atan2
+ * @param angles Destination for n 15-bit binary angle measurements
+ * @param coords n pairs of x, y signed fixed point coords around circle
+ * @param n Number of pairs
+ */
+void __agbabi_atan2_array(unsigned int* angles, const int* coords, size_t n) __attribute__((nonnull(1, 2)));
+
 /**
  * Calculates the integer square root of x
  * @param x
@@ -171,6 +640,133 @@ unsigned int __agbabi_atan2(int x, int y) __attribute__((const));
  */
 int __agbabi_sqrt(unsigned int x) __attribute__((const));
 
+/**
+ * Calculates the integer square root of a 64-bit x
+ * @param x
+ * @return Square root of x
+ */
+unsigned int __agbabi_sqrt64(unsigned long long x) __attribute__((const));
+
+/**
+ * Reciprocal square root approximation, accurate to about 15 bits
+ * Inputs of 1/16 and below saturate to 0xffffffff
+ * @param x Q16 unsigned fixed point
+ * @return Q30 unsigned fixed point 1 / sqrt(x)
+ */
+unsigned int __agbabi_rsqrt(unsigned int x) __attribute__((const));
+
+/**
+ * Calculates 2 to the power of x
+ * Results of 2^16 and above saturate to 0xffffffff
+ * @param x Q16 signed fixed point
+ * @return Q16 unsigned fixed point, rounded
+ */
+unsigned int __agbabi_exp2(int x) __attribute__((const));
+
+/**
+ * Fills dest with 2 to the power of n exponents, from start in increments of step
+ * @param dest
+ * @param start Q16 signed fixed point
+ * @param step Q16 signed fixed point
+ * @param n Number of elements
+ */
+void __agbabi_exp2_array(unsigned int* dest, int start, int step, size_t n) __attribute__((nonnull(1)));
+
+/**
+ * Calculates the base 2 logarithm of x
+ * @param x Q16 unsigned fixed point
+ * @return Q16 signed fixed point, rounded, or INT_MIN when x is 0
+ */
+int __agbabi_log2(unsigned int x) __attribute__((const));
+
+/**
+ * Calculates x to the power of y
+ * Results of 2^16 and above saturate to 0xffffffff
+ * @param x Q16 unsigned fixed point
+ * @param y Q16 signed fixed point
+ * @return Q16 unsigned fixed point, rounded
+ */
+unsigned int __agbabi_pow(unsigned int x, int y) __attribute__((const));
+
+/**
+ * Raises n elements of x to the power of y
+ * dest may be the same array as x
+ * @param dest
+ * @param x Q16 unsigned fixed point
+ * @param y Q16 signed fixed point
+ * @param n Number of elements
+ */
+void __agbabi_pow_array(unsigned int* dest, const unsigned int* x, int y, size_t n) __attribute__((nonnull(1, 2)));
+
+/**
+ * Object affine source, same layout as the BIOS ObjAffineSet source
+ * @param sx 8.8 signed fixed point horizontal scale, 0x100 = 1.0
+ * @param sy 8.8 signed fixed point vertical scale, 0x100 = 1.0
+ * @param angle 16-bit binary angle measurement, 0x10000 = 360 degrees
+ */
+typedef struct {
+    short sx;
+    short sy;
+    unsigned short angle;
+    unsigned short reserved;
+} __attribute__((aligned(4))) __agbabi_obj_affine_src_t;
+
+/**
+ * Background affine source, same layout as the BIOS BgAffineSet source
+ * @param tex_x 24.8 signed fixed point texture x placed at scr_x
+ * @param tex_y 24.8 signed fixed point texture y placed at scr_y
+ * @param scr_x Screen x of the center of rotation
+ * @param scr_y Screen y of the center of rotation
+ * @param sx 8.8 signed fixed point horizontal scale, 0x100 = 1.0
+ * @param sy 8.8 signed fixed point vertical scale, 0x100 = 1.0
+ * @param angle 16-bit binary angle measurement, 0x10000 = 360 degrees
+ */
+typedef struct {
+    int tex_x;
+    int tex_y;
+    short scr_x;
+    short scr_y;
+    short sx;
+    short sy;
+    unsigned short angle;
+    unsigned short reserved;
+} __agbabi_bg_affine_src_t;
+
+/**
+ * Background affine parameters, same layout as the BGxPA to BGxY registers
+ * @param pa 8.8 signed fixed point
+ * @param pb 8.8 signed fixed point
+ * @param pc 8.8 signed fixed point
+ * @param pd 8.8 signed fixed point
+ * @param dx 24.8 signed fixed point texture x at the screen origin
+ * @param dy 24.8 signed fixed point texture y at the screen origin
+ */
+typedef struct {
+    short pa;
+    short pb;
+    short pc;
+    short pd;
+    int dx;
+    int dy;
+} __agbabi_bg_affine_dst_t;
+
+/**
+ * Replacement for BIOS ObjAffineSet, writes n matrices of pa, pb, pc, pd
+ * @param src n scales and angles
+ * @param dest Address of the first pa, such as OAM + 6
+ * @param n Number of matrices
+ * @param stride Bytes between each parameter, 2 when packed or 8 for OAM
+ */
+void __agbabi_obj_affine_set(const __agbabi_obj_affine_src_t* src, void* dest, size_t n, size_t stride) __attribute__((nonnull(1, 2)));
+
+/**
+ * Replacement for BIOS BgAffineSet, writes n sets of affine parameters
+ * @param src n centers, scales, and angles
+ * @param dest Destination, such as the BG2PA register
+ * @param n Number of sets
+ */
+void __agbabi_bg_affine_set(const __agbabi_bg_affine_src_t* src, __agbabi_bg_affine_dst_t* dest, size_t n) __attribute__((nonnull(1, 2)));
+
 /**
  * Empty IRQ handler that acknowledges raised IRQs
  */
@@ -0,0 +1,118 @@
+@===============================================================================
+@
+@ Support:
+@    __agbabi_obj_affine_set, __agbabi_bg_affine_set
+@
+@ Same source and destination layouts as BIOS ObjAffineSet and BgAffineSet
+@
+@ Copyright (C) 2021-2023 agbabi contributors
+@ For conditions of distribution and use, see copyright notice in LICENSE.md
+@
+@===============================================================================
+
+.syntax unified
+.include "macros.inc"
+
+    .arm
+    .align 2
+
+    .section .iwram.__agbabi_obj_affine_set, "ax", %progbits
+    .global __agbabi_obj_affine_set
+    .type __agbabi_obj_affine_set, %function
+__agbabi_obj_affine_set:
+    @ r0 = src, r1 = dest, r2 = n, r3 = stride
+    cmp     r2, #0
+    bxeq    lr
+    push    {r4-r11}
+
+.Lobj_affine_set_loop:
+    @ r4 = sx | sy << 16, r5 = angle
+    ldmia   r0!, {r4-r5}
+
+    @ r6 = Q29 sin, r7 = Q29 cos of the 16-bit angle
+    lsr     r5, r5, #1
+    add     r7, r5, #0x2000
+    sin_q29 r6, r5, r12
+    sin_q29 r7, r7, r12
+
+    @ r8 = sx, r9 = sy, shifted so the high words of the products are 8.8
+    lsl     r8, r4, #16
+    asr     r8, r8, #13
+    asr     r9, r4, #16
+    lsl     r9, r9, #3
+
+    @ pa = sx * cos, pb = -sx * sin, pc = sy * sin, pd = sy * cos
+    smull   r10, r11, r8, r7
+    strh    r11, [r1], r3
+    rsb     r8, r8, #0
+    smull   r10, r11, r8, r6
+    strh    r11, [r1], r3
+    smull   r10, r11, r9, r6
+    strh    r11, [r1], r3
+    smull   r10, r11, r9, r7
+    strh    r11, [r1], r3
+
+    subs    r2, r2, #1
+    bne     .Lobj_affine_set_loop
+
+    pop     {r4-r11}
+    bx      lr
+
+    .section .iwram.__agbabi_bg_affine_set, "ax", %progbits
+    .global __agbabi_bg_affine_set
+    .type __agbabi_bg_affine_set, %function
+__agbabi_bg_affine_set:
+    @ r0 = src, r1 = dest, r2 = n
+    cmp     r2, #0
+    bxeq    lr
+    push    {r4-r11, lr}
+
+.Lbg_affine_set_loop:
+    @ r4 = tex_x, r5 = tex_y, r6 = scr_x | scr_y << 16, r7 = sx | sy << 16, r8 = angle
+    ldmia   r0!, {r4-r8}
+
+    @ r8 = Q29 sin, r3 = Q29 cos of the 16-bit angle
+    lsr     r8, r8, #1
+    add     r3, r8, #0x2000
+    sin_q29 r8, r8, r12
+    sin_q29 r3, r3, r12
+
+    @ r9 = sx, r7 = sy, shifted so the high words of the products are 8.8
+    lsl     r9, r7, #16
+    asr     r9, r9, #13
+    asr     r7, r7, #16
+    lsl     r7, r7, #3
+
+    @ r11 = pa, lr = pb, r9 = pc, r8 = pd
+    smull   r10, r11, r9, r3
+    rsb     r9, r9, #0
+    smull   r10, lr, r9, r8
+    smull   r10, r9, r7, r8
+    smull   r10, r8, r7, r3
+
+    @ Move the screen center onto the texture center
+    lsl     r7, r6, #16
+    asr     r7, r7, #16
+    asr     r6, r6, #16
+    mul     r10, r11, r7
+    mla     r10, lr, r6, r10
+    sub     r4, r4, r10
+    mul     r10, r9, r7
+    mla     r10, r8, r6, r10
+    sub     r7, r5, r10
+    mov     r6, r4
+
+    @ r4 = pa | pb << 16, r5 = pc | pd << 16, r6 = dx, r7 = dy
+    lsl     r11, r11, #16
+    lsr     r11, r11, #16
+    orr     r4, r11, lr, lsl #16
+    lsl     r9, r9, #16
+    lsr     r9, r9, #16
+    orr     r5, r9, r8, lsl #16
+    stmia   r1!, {r4-r7}
+
+    subs    r2, r2, #1
+    bne     .Lbg_affine_set_loop
+
+    pop     {r4-r11, lr}
+    bx      lr
@@ -0,0 +1,133 @@
+@===============================================================================
+@
+@ Support:
+@    __agbabi_atan2_array
+@
+@ Polynomial taken from https://www.coranac.com/documents/arctangent/ by Jasper "cearn" Vijn
+@ Modified for libagbabi
+@
+@===============================================================================
+
+.syntax unified
+
+    .arm
+    .align 2
+
+    .section .iwram.__agbabi_atan2_array, "ax", %progbits
+    .global __agbabi_atan2_array
+    .type __agbabi_atan2_array, %function
+__agbabi_atan2_array:
+    @ r0 = angles, r1 = coords, r2 = n
+    cmp     r2, #0
+    bxeq    lr
+    push    {r4-r11, lr}
+
+    @ r7-r10 = polynomial coefficients, r6 = reciprocal seeds indexed from 128
+    adr     r6, .Latan2_array_coefficients
+    ldmia   r6!, {r7-r10}
+    sub     r6, r6, #256
+
+.Latan2_array_loop:
+    @ r3 = x, r4 = y
+    ldmia   r1!, {r3-r4}
+    cmp     r4, #0
+    beq     .Latan2_array_axis
+
+    @ Rotate into the first octant, r5 = angle of the octant
+    rsblt   r3, r3, #0
+    rsblt   r4, r4, #0
+    movlt   r5, #0x4000
+    movge   r5, #0
+    cmp     r3, #0
+    movle   r12, r3
+    movle   r3, r4
+    rsble   r4, r12, #0
+    orrle   r5, r5, #0x2000
+    cmp     r3, r4
+    suble   r12, r4, r3
+    addle   r3, r3, r4
+    movle   r4, r12
+    orrle   r5, r5, #0x1000
+
+    @ Now 0 <= y < x, shift both until x is Q32 between 0.5 and 1
+    cmp     r3, #1 << 16
+    lsllo   r3, r3, #16
+    lsllo   r4, r4, #16
+    cmp     r3, #1 << 24
+    lsllo   r3, r3, #8
+    lsllo   r4, r4, #8
+    cmp     r3, #1 << 28
+    lsllo   r3, r3, #4
+    lsllo   r4, r4, #4
+    cmp     r3, #1 << 30
+    lsllo   r3, r3, #2
+    lsllo   r4, r4, #2
+    cmp     r3, #1 << 31
+    lsllo   r3, r3, #1
+    lsllo   r4, r4, #1
+
+    @ r12 = Q15 reciprocal seed from the top 8 bits of x
+    lsr     r12, r3, #23
+    bic     r12, r12, #1
+    ldrh    r12, [r6, r12]
+
+    @ One Newton-Raphson step, r11 = Q30 1 / x
+    umull   r11, lr, r3, r12
+    rsb     lr, lr, #0x10000
+    mul     r11, r12, lr
+
+    @ r12 = Q15 y / x, without the division of __agbabi_atan2
+    umull   r12, lr, r4, r11
+    lsr     r12, lr, #15
+
+    @ Same polynomial as __agbabi_atan2, r11 = -t^2
+    mul     r11, r12, r12
+    rsb     r11, r11, #0
+    asr     r11, r11, #15
+    mov     lr, #0x0470
+    mul     lr, r11, lr
+    add     lr, r7, lr, asr #15
+    mul     lr, r11, lr
+    add     lr, r8, lr, asr #15
+    mul     lr, r11, lr
+    add     lr, r9, lr, asr #15
+    mul     lr, r11, lr
+    add     lr, r10, lr, asr #15
+    mul     lr, r12, lr
+    add     lr, lr, #4 << 15
+    add     r5, r5, lr, asr #18
+
+.Latan2_array_store:
+    str     r5, [r0], #4
+    subs    r2, r2, #1
+    bne     .Latan2_array_loop
+
+    pop     {r4-r11, lr}
+    bx      lr
+
+.Latan2_array_axis:
+    @ y == 0, the angle is 0 or half a turn
+    cmp     r3, #0
+    movge   r5, #0
+    movlt   r5, #0x4000
+    b       .Latan2_array_store
+
+.Latan2_array_coefficients:
+    .word   0x1029, 0x1F0B, 0x364C, 0xA2FC
+    @ 1 / x at the middle of each 128th of 0.5 to 1, Q15
+    .hword  0xff01, 0xfd09, 0xfb19, 0xf930, 0xf74e, 0xf574, 0xf3a1, 0xf1d5
+    .hword  0xf00f, 0xee50, 0xec98, 0xeae5, 0xe939, 0xe793, 0xe5f3, 0xe459
+    .hword  0xe2c5, 0xe136, 0xdfac, 0xde28, 0xdca9, 0xdb2f, 0xd9ba, 0xd84a
+    .hword  0xd6df, 0xd579, 0xd417, 0xd2ba, 0xd161, 0xd00d, 0xcebd, 0xcd71
+    .hword  0xcc29, 0xcae6, 0xc9a6, 0xc86a, 0xc733, 0xc5fe, 0xc4ce, 0xc3a1
+    .hword  0xc278, 0xc152, 0xc030, 0xbf11, 0xbdf6, 0xbcdd, 0xbbc8, 0xbab6
+    .hword  0xb9a8, 0xb89c, 0xb793, 0xb68d, 0xb58a, 0xb48a, 0xb38d, 0xb292
+    .hword  0xb19b, 0xb0a6, 0xafb3, 0xaec3, 0xadd6, 0xaceb, 0xac03, 0xab1d
+    .hword  0xaa39, 0xa958, 0xa879, 0xa79c, 0xa6c2, 0xa5ea, 0xa514, 0xa440
+    .hword  0xa36e, 0xa29f, 0xa1d1, 0xa106, 0xa03c, 0x9f74, 0x9eaf, 0x9deb
+    .hword  0x9d29, 0x9c69, 0x9bab, 0x9aee, 0x9a34, 0x997b, 0x98c4, 0x980e
+    .hword  0x975a, 0x96a8, 0x95f8, 0x9549, 0x949c, 0x93f0, 0x9346, 0x929d
+    .hword  0x91f6, 0x9150, 0x90ac, 0x9009, 0x8f68, 0x8ec8, 0x8e29, 0x8d8c
+    .hword  0x8cf0, 0x8c56, 0x8bbc, 0x8b24, 0x8a8e, 0x89f8, 0x8964, 0x88d2
+    .hword  0x8840, 0x87af, 0x8720, 0x8692, 0x8605, 0x8579, 0x84ef, 0x8465
+    .hword  0x83dd, 0x8356, 0x82cf, 0x824a, 0x81c6, 0x8143, 0x80c1, 0x8040
@@ -0,0 +1,160 @@
+@===============================================================================
+@
+@ Support:
+@    __clzsi2, __clzdi2, __ctzsi2, __ctzdi2, __popcountsi2, __popcountdi2
+@
+@ Replaces the generic libgcc helpers, as ARMv4T has no CLZ instruction
+@ Zero inputs return the bit width (32 or 64)
+@
+@ Copyright (C) 2021-2023 agbabi contributors
+@ For conditions of distribution and use, see copyright notice in LICENSE.md
+@
+@===============================================================================
+
+.syntax unified
+
+    .arm
+    .align 2
+
+    .section .iwram.__clzsi2, "ax", %progbits
+    .global __clzdi2
+    .type __clzdi2, %function
+__clzdi2:
+    @ Count the high word, or 32 + the low word when the high word is zero
+    cmp     r1, #0
+    movne   r0, r1
+    movne   r1, #32
+    moveq   r1, #64
+    b       .Lclz
+
+    .global __clzsi2
+    .type __clzsi2, %function
+__clzsi2:
+    mov     r1, #32
+
+.Lclz:
+    @ Same estimator as __agbabi_unsafe_uidivmod, subtract the bit length from r1
+    cmp     r0, #1 << 16
+    lsrhs   r0, r0, #16
+    subhs   r1, r1, #16
+
+    cmp     r0, #1 << 8
+    lsrhs   r0, r0, #8
+    subhs   r1, r1, #8
+
+    cmp     r0, #1 << 4
+    lsrhs   r0, r0, #4
+    subhs   r1, r1, #4
+
+    cmp     r0, #1 << 2
+    lsrhs   r0, r0, #2
+    subhs   r1, r1, #2
+
+    @ r0 is now 0 to 3, with a bit length of 0, 1, 2, 2
+    cmp     r0, #2
+    subhs   r0, r1, #2
+    sublo   r0, r1, r0
+    bx      lr
+
+    .section .iwram.__ctzsi2, "ax", %progbits
+    .global __ctzdi2
+    .type __ctzdi2, %function
+__ctzdi2:
+    @ Count the low word, or 32 + the high word when the low word is zero
+    cmp     r0, #0
+    moveq   r0, r1
+    moveq   r1, #32
+    movne   r1, #0
+    b       .Lctz
+
+    .global __ctzsi2
+    .type __ctzsi2, %function
+__ctzsi2:
+    mov     r1, #0
+
+.Lctz:
+    @ Isolate the lowest set bit
+    rsb     r2, r0, #0
+    ands    r0, r0, r2
+    addeq   r0, r1, #32
+    bxeq    lr
+
+    @ De Bruijn multiply, the top 5 bits are unique for each bit position
+    ldr     r2, .Lde_bruijn
+    mul     r0, r2, r0
+    adr     r2, .Lde_bruijn_position
+    ldrb    r0, [r2, r0, lsr #27]
+    add     r0, r0, r1
+    bx      lr
+
+.Lde_bruijn:
+    .word   0x077cb531
+.Lde_bruijn_position:
+    .byte   0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8
+    .byte   31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+
+    .section .iwram.__popcountsi2, "ax", %progbits
+    .global __popcountsi2
+    .type __popcountsi2, %function
+__popcountsi2:
+    @ r2 = 0x33333333, r12 = 0x55555555
+    mov     r2, #0x33
+    orr     r2, r2, r2, lsl #8
+    orr     r2, r2, r2, lsl #16
+    eor     r12, r2, r2, lsl #1
+
+    @ Count bits in pairs, then in nibbles
+    and     r1, r12, r0, lsr #1
+    sub     r0, r0, r1
+    and     r1, r2, r0, lsr #2
+    and     r0, r0, r2
+    add     r0, r0, r1
+
+    @ Sum nibbles into bytes, then bytes into the low byte
+    mov     r2, #0x0f
+    orr     r2, r2, r2, lsl #8
+    orr     r2, r2, r2, lsl #16
+    add     r0, r0, r0, lsr #4
+    and     r0, r0, r2
+    add     r0, r0, r0, lsr #8
+    add     r0, r0, r0, lsr #16
+    and     r0, r0, #0x3f
+    bx      lr
+
+    .global __popcountdi2
+    .type __popcountdi2, %function
+__popcountdi2:
+    @ r2 = 0x33333333, r12 = 0x55555555
+    mov     r2, #0x33
+    orr     r2, r2, r2, lsl #8
+    orr     r2, r2, r2, lsl #16
+    eor     r12, r2, r2, lsl #1
+
+    @ Count bits in pairs, then in nibbles, for both words
+    and     r3, r12, r0, lsr #1
+    sub     r0, r0, r3
+    and     r3, r12, r1, lsr #1
+    sub     r1, r1, r3
+    and     r3, r2, r0, lsr #2
+    and     r0, r0, r2
+    add     r0, r0, r3
+    and     r3, r2, r1, lsr #2
+    and     r1, r1, r2
+    add     r1, r1, r3
+
+    @ Nibbles of both words sum to at most 8
+    add     r0, r0, r1
+
+    @ Sum nibbles into bytes, masking first as a byte may reach 16
+    mov     r2, #0x0f
+    orr     r2, r2, r2, lsl #8
+    orr     r2, r2, r2, lsl #16
+    and     r1, r2, r0, lsr #4
+    and     r0, r0, r2
+    add     r0, r0, r1
+
+    @ Sum bytes into the low byte
+    add     r0, r0, r0, lsr #8
+    add     r0, r0, r0, lsr #16
+    and     r0, r0, #0x7f
+    bx      lr
@@ -0,0 +1,206 @@
+@===============================================================================
+@
+@ Support:
+@    __agbabi_uidiv_array, __agbabi_uimod_array, __agbabi_uidiv_arrays,
+@    __agbabi_idiv_array, __agbabi_imod_array, __agbabi_idiv_arrays
+@
+@ Division loop from __agbabi_unsafe_uidivmod, kept in registers across elements
+@
+@ Copyright (C) 2021-2023 agbabi contributors
+@ For conditions of distribution and use, see copyright notice in LICENSE.md
+@
+@===============================================================================
+
+.syntax unified
+.include "macros.inc"
+
+@ __agbabi_unsafe_uidivmod of \num by non-zero \denom, \negdenom = -\denom
+@ Branches to \done when \num < \denom
+.macro uidivmod_or_done num, rem, denom, negdenom, counter, done
+    cmp     \num, \denom
+    movlo   \rem, \num
+    movlo   \num, #0
+    blo     \done
+    uidivmod \num, \rem, \denom, \negdenom, \counter
+.endm
+
+    .arm
+    .align 2
+
+    @ r0: quotients / r1: numerators / r2: the denominator / r3: count
+    .section .iwram.__agbabi_uidiv_array, "ax", %progbits
+    .global __agbabi_uimod_array
+    .type __agbabi_uimod_array, %function
+__agbabi_uimod_array:
+    mov     r12, #1
+    b       .Luidiv_array
+
+    .global __agbabi_uidiv_array
+    .type __agbabi_uidiv_array, %function
+__agbabi_uidiv_array:
+    mov     r12, #0
+
+.Luidiv_array:
+    @ Check for division by zero
+    cmp     r2, #0
+    .extern __aeabi_idiv0
+    beq     __aeabi_idiv0
+
+    cmp     r3, #0
+    bxeq    lr
+
+    push    {r4-r7}
+    rsb     r4, r2, #0
+
+.Luidiv_array_loop:
+    ldr     r5, [r1], #4
+    uidivmod_or_done r5, r6, r2, r4, r7, .Luidiv_array_store
+.Luidiv_array_store:
+    @ r12 selects the remainder
+    cmp     r12, #0
+    movne   r5, r6
+    str     r5, [r0], #4
+    subs    r3, r3, #1
+    bne     .Luidiv_array_loop
+
+    pop     {r4-r7}
+    bx      lr
+
+    @ r0: quotients / r1: numerators / r2: denominators / r3: count
+    .section .iwram.__agbabi_uidiv_arrays, "ax", %progbits
+    .global __agbabi_uidiv_arrays
+    .type __agbabi_uidiv_arrays, %function
+__agbabi_uidiv_arrays:
+    cmp     r3, #0
+    bxeq    lr
+
+    push    {r4-r8, lr}
+
+.Luidiv_arrays_loop:
+    ldr     r5, [r1], #4
+    ldr     r8, [r2], #4
+    cmp     r8, #0
+    beq     .Luidiv_arrays_zero
+
+    rsb     r4, r8, #0
+    uidivmod_or_done r5, r6, r8, r4, r7, .Luidiv_arrays_store
+.Luidiv_arrays_store:
+    str     r5, [r0], #4
+    subs    r3, r3, #1
+    bne     .Luidiv_arrays_loop
+
+    pop     {r4-r8, lr}
+    bx      lr
+
+.Luidiv_arrays_zero:
+    @ The quotient is whatever __aeabi_idiv0 returns
+    push    {r0-r3}
+    mov     r0, r5
+    bl      __aeabi_idiv0
+    mov     r5, r0
+    pop     {r0-r3}
+    b       .Luidiv_arrays_store
+
+    @ r0: quotients / r1: numerators / r2: the denominator / r3: count
+    .section .iwram.__agbabi_idiv_array, "ax", %progbits
+    .global __agbabi_imod_array
+    .type __agbabi_imod_array, %function
+__agbabi_imod_array:
+    mov     r12, #1
+    b       .Lidiv_array
+
+    .global __agbabi_idiv_array
+    .type __agbabi_idiv_array, %function
+__agbabi_idiv_array:
+    mov     r12, #0
+
+.Lidiv_array:
+    @ Check for division by zero
+    cmp     r2, #0
+    beq     __aeabi_idiv0
+
+    cmp     r3, #0
+    bxeq    lr
+
+    push    {r4-r9}
+
+    @ r8 = sign of the denominator, r2 = abs(denominator)
+    asr     r8, r2, #31
+    eor     r2, r2, r8
+    sub     r2, r2, r8
+    rsb     r4, r2, #0
+
+.Lidiv_array_loop:
+    ldr     r5, [r1], #4
+
+    @ r9 = sign of the numerator, r5 = abs(numerator)
+    asr     r9, r5, #31
+    eor     r5, r5, r9
+    sub     r5, r5, r9
+
+    uidivmod_or_done r5, r6, r2, r4, r7, .Lidiv_array_sign
+.Lidiv_array_sign:
+    @ The quotient is negative when exactly one operand is
+    @ The remainder takes the sign of the numerator
+    cmp     r12, #0
+    eoreq   r9, r9, r8
+    movne   r5, r6
+    eor     r5, r5, r9
+    sub     r5, r5, r9
+
+    str     r5, [r0], #4
+    subs    r3, r3, #1
+    bne     .Lidiv_array_loop
+
+    pop     {r4-r9}
+    bx      lr
+
+    @ r0: quotients / r1: numerators / r2: denominators / r3: count
+    .section .iwram.__agbabi_idiv_arrays, "ax", %progbits
+    .global __agbabi_idiv_arrays
+    .type __agbabi_idiv_arrays, %function
+__agbabi_idiv_arrays:
+    cmp     r3, #0
+    bxeq    lr
+
+    push    {r4-r10, lr}
+
+.Lidiv_arrays_loop:
+    ldr     r5, [r1], #4
+    ldr     r10, [r2], #4
+    cmp     r10, #0
+    beq     .Lidiv_arrays_zero
+
+    @ r8 = sign of the denominator, r10 = abs(denominator)
+    asr     r8, r10, #31
+    eor     r10, r10, r8
+    sub     r10, r10, r8
+    rsb     r4, r10, #0
+
+    @ r9 = sign of the quotient, r5 = abs(numerator)
+    asr     r9, r5, #31
+    eor     r5, r5, r9
+    sub     r5, r5, r9
+    eor     r9, r9, r8
+
+    uidivmod_or_done r5, r6, r10, r4, r7, .Lidiv_arrays_sign
+.Lidiv_arrays_sign:
+    eor     r5, r5, r9
+    sub     r5, r5, r9
+
+.Lidiv_arrays_store:
+    str     r5, [r0], #4
+    subs    r3, r3, #1
+    bne     .Lidiv_arrays_loop
+
+    pop     {r4-r10, lr}
+    bx      lr
+
+.Lidiv_arrays_zero:
+    @ The quotient is whatever __aeabi_idiv0 returns
+    push    {r0-r3}
+    mov     r0, r5
+    bl      __aeabi_idiv0
+    mov     r5, r0
+    pop     {r0-r3}
+    b       .Lidiv_arrays_store
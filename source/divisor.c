@@ -0,0 +1,115 @@
+/*
+===============================================================================
+
+ Support:
+    __agbabi_udiv_prepare, __agbabi_idiv_prepare, __agbabi_uluidiv_prepare
+
+ Magic numbers follow libdivide by ridiculous_fish (github.com/ridiculousfish/libdivide)
+ Modified for libagbabi
+
+ Copyright (C) 2021-2023 agbabi contributors
+ For conditions of distribution and use, see copyright notice in LICENSE.md
+
+===============================================================================
+*/
+
+#include <agbabi.h>
+
+#define ADD_MARKER (0x100u)
+#define NEGATIVE_DIVISOR (0x80000000u)
+
+typedef unsigned int u32;
+typedef unsigned long long u64;
+
+static u32 floor_log2(u32 x);
+
+void __agbabi_udiv_prepare(__agbabi_udiv_t* div, unsigned int denominator) {
+    const u32 l = floor_log2(denominator);
+
+    if ((denominator & (denominator - 1)) == 0) {
+        div->magic = 0;
+        div->more = l;
+        return;
+    }
+
+    /* 2^(32 + l) / denominator, the quotient fits as denominator > 2^l */
+    const u64 numerator = (u64) (1u << l) << 32;
+    u32 magic = (u32) (numerator / denominator);
+    const u32 rem = (u32) (numerator % denominator);
+
+    if (denominator - rem < (1u << l)) {
+        div->more = l;
+    } else {
+        /* Needs a 33-bit multiplier, the numerator is added back after the multiply */
+        magic += magic;
+        if ((u64) rem + rem >= denominator) {
+            ++magic;
+        }
+        div->more = l | ADD_MARKER;
+    }
+    div->magic = magic + 1;
+}
+
+void __agbabi_idiv_prepare(__agbabi_idiv_t* div, int denominator) {
+    const u32 abs_denominator = denominator < 0 ? -(u32) denominator : (u32) denominator;
+    const u32 l = floor_log2(abs_denominator);
+    const u32 sign = denominator < 0 ? NEGATIVE_DIVISOR : 0;
+
+    if ((abs_denominator & (abs_denominator - 1)) == 0) {
+        div->magic = 0;
+        div->more = l | sign;
+        return;
+    }
+
+    /* 2^(31 + l) / abs_denominator */
+    const u64 numerator = (u64) (1u << (l - 1)) << 32;
+    u32 magic = (u32) (numerator / abs_denominator);
+    const u32 rem = (u32) (numerator % abs_denominator);
+
+    u32 more;
+    if (abs_denominator - rem < (1u << l)) {
+        more = l - 1;
+    } else {
+        magic += magic;
+        if ((u64) rem + rem >= abs_denominator) {
+            ++magic;
+        }
+        more = l | ADD_MARKER;
+    }
+    ++magic;
+
+    div->magic = (int) (denominator < 0 ? -magic : magic);
+    div->more = more | sign;
+}
+
+void __agbabi_uluidiv_prepare(__agbabi_uluidiv_t* div, unsigned int denominator) {
+    const u32 l = floor_log2(denominator);
+
+    if ((denominator & (denominator - 1)) == 0) {
+        div->magic = 0;
+        div->more = l;
+        return;
+    }
+
+    /* 2^(64 + l) / denominator, one 32-bit digit at a time */
+    u64 rem = (u64) (1u << l) << 32;
+    const u64 magic_hi = rem / denominator;
+    rem = (rem % denominator) << 32;
+    u64 magic = (magic_hi << 32) | (u32) (rem / denominator);
+    rem %= denominator;
+
+    if (denominator - rem < (1u << l)) {
+        div->more = l;
+    } else {
+        magic += magic;
+        if (rem + rem >= denominator) {
+            ++magic;
+        }
+        div->more = l | ADD_MARKER;
+    }
+    div->magic = magic + 1;
+}
+
+u32 floor_log2(u32 x) {
+    return 31u - (u32) __builtin_clz(x);
+}
@@ -0,0 +1,131 @@
+@===============================================================================
+@
+@ Support:
+@    __agbabi_udiv_prepared, __agbabi_idiv_prepared, __agbabi_uluidiv_prepared
+@
+@ Division by a divisor prepared with __agbabi_*_prepare
+@ Magic numbers follow libdivide by ridiculous_fish (github.com/ridiculousfish/libdivide)
+@
+@ Copyright (C) 2021-2023 agbabi contributors
+@ For conditions of distribution and use, see copyright notice in LICENSE.md
+@
+@===============================================================================
+
+.syntax unified
+
+@ more: bits 0-7 are the shift, bit 8 is the add marker, bit 31 is the negative divisor flag
+@ Register specified shifts only read bits 0-7, so more can be used as a shift directly
+.set ADD_MARKER, 0x100
+
+    .arm
+    .align 2
+
+    .section .iwram.__agbabi_udiv_prepared, "ax", %progbits
+    .global __agbabi_udiv_prepared
+    .type __agbabi_udiv_prepared, %function
+__agbabi_udiv_prepared:
+    @ r0 = numerator, r1 = magic, r2 = more
+    ldmia   r1, {r1, r2}
+
+    @ Power of two
+    cmp     r1, #0
+    lsreq   r0, r0, r2
+    bxeq    lr
+
+    umull   r3, r1, r0, r1
+
+    @ 33-bit magic: add back (numerator - high) / 2 without overflowing
+    tst     r2, #ADD_MARKER
+    subne   r0, r0, r1
+    addne   r1, r1, r0, lsr #1
+
+    lsr     r0, r1, r2
+    bx      lr
+
+    .section .iwram.__agbabi_idiv_prepared, "ax", %progbits
+    .global __agbabi_idiv_prepared
+    .type __agbabi_idiv_prepared, %function
+__agbabi_idiv_prepared:
+    @ r0 = numerator, r1 = magic, r2 = more
+    ldmia   r1, {r1, r2}
+
+    cmp     r1, #0
+    beq     .Lidiv_pow2
+
+    smull   r3, r1, r0, r1
+
+    @ 33-bit magic: add back the numerator, negated for a negative divisor
+    tst     r2, #ADD_MARKER
+    eorne   r3, r0, r2, asr #31
+    subne   r3, r3, r2, asr #31
+    addne   r1, r1, r3
+
+    @ Round towards zero
+    asr     r0, r1, r2
+    add     r0, r0, r0, lsr #31
+    bx      lr
+
+.Lidiv_pow2:
+    @ Bias negative numerators by (1 << shift) - 1 to round towards zero
+    mov     r3, #1
+    rsb     r3, r3, r3, lsl r2
+    and     r3, r3, r0, asr #31
+    add     r0, r0, r3
+    asr     r0, r0, r2
+
+    @ Negate for a negative divisor
+    eor     r0, r0, r2, asr #31
+    sub     r0, r0, r2, asr #31
+    bx      lr
+
+    .section .iwram.__agbabi_uluidiv_prepared, "ax", %progbits
+    .global __agbabi_uluidiv_prepared
+    .type __agbabi_uluidiv_prepared, %function
+__agbabi_uluidiv_prepared:
+    @ r0:r1 = numerator, r2:r3 = magic, r12 = more
+    ldmia   r2, {r2, r3, r12}
+
+    @ Power of two
+    cmp     r2, #0
+    cmpeq   r3, #0
+    beq     .Luluidiv_shift
+
+    push    {r4-r6}
+
+    @ r6:r5 = high 64-bits of the 128-bit product of numerator and magic
+    umull   r5, r4, r2, r0
+    mov     r5, #0
+    umlal   r4, r5, r2, r1
+    mov     r6, #0
+    umlal   r4, r6, r3, r0
+    adds    r5, r5, r6
+    mov     r6, #0
+    adc     r6, r6, #0
+    umlal   r5, r6, r3, r1
+
+    @ 65-bit magic: add back (numerator - high) / 2 without overflowing
+    tst     r12, #ADD_MARKER
+    bne     .Luluidiv_add
+
+    mov     r0, r5
+    mov     r1, r6
+    pop     {r4-r6}
+    b       .Luluidiv_shift
+
+.Luluidiv_add:
+    subs    r0, r0, r5
+    sbc     r1, r1, r6
+    lsrs    r1, r1, #1
+    rrx     r0, r0
+    adds    r0, r0, r5
+    adc     r1, r1, r6
+    pop     {r4-r6}
+    @ Fallthrough
+
+.Luluidiv_shift:
+    @ r0:r1 >>= shift, shift is less than 32
+    rsb     r3, r12, #32
+    lsr     r0, r0, r12
+    orr     r0, r0, r1, lsl r3
+    lsr     r1, r1, r12
+    bx      lr
@@ -0,0 +1,127 @@
+/*
+===============================================================================
+
+ Support:
+    __agbabi_dma_memcpy, __agbabi_dma_memcpy4, __agbabi_dma_memset,
+    __agbabi_dma_memset4
+
+ Copyright (C) 2021-2023 agbabi contributors
+ For conditions of distribution and use, see copyright notice in LICENSE.md
+
+===============================================================================
+*/
+
+#include <aeabi.h>
+#include <agbabi.h>
+
+typedef unsigned short u16;
+typedef unsigned int u32;
+typedef volatile u32 vu32;
+
+#define ADDR_DMA3SAD ((const void* volatile*) 0x40000D4)
+#define ADDR_DMA3DAD ((void* volatile*) 0x40000D8)
+#define ADDR_DMA3CNT ((vu32*) 0x40000DC)
+
+#define DMA_SRC_FIXED   (0x0100)
+#define DMA_32BIT       (0x0400)
+#define DMA_ENABLE      (0x8000)
+
+/* DMA3 word count of 0 transfers 0x10000 units */
+#define DMA3_MAX_COUNT (0x10000u)
+
+/*
+ * dma_threshold rows of test/bench.c under test/runner, from ewram
+ * Word aligned DMA copies break even with __aeabi_memcpy4 at 832 bytes into ewram (2658 vs 2657 cycles),
+ * iwram (1618 vs 1617) and vram (1826 vs 1826), and lose below (256 bytes into ewram: 929 vs 822)
+ */
+#define DMA32_MEMCPY_THRESHOLD (832u)
+
+/*
+ * Off-by-half copies compete with the shifting CPU copy, so 16-bit DMA wins sooner
+ * It breaks even at 160 bytes into ewram (641 vs 648 cycles) and vram (482 vs 488),
+ * and at 224 bytes into iwram (609 vs 606), then wins from 256 bytes in every region
+ */
+#define DMA16_MEMCPY_THRESHOLD (256u)
+
+#define likely(x) __builtin_expect(!!(x), 1)
+#define unlikely(x) __builtin_expect(!!(x), 0)
+
+static void dma3_transfer(void* dest, const void* src, size_t count, u32 control);
+
+void __agbabi_dma_memcpy(void* __restrict__ dest, const void* __restrict__ src, size_t n) {
+    const u32 misalign = (u32) dest ^ (u32) src;
+
+    const size_t threshold = (misalign & 2) ? DMA16_MEMCPY_THRESHOLD : DMA32_MEMCPY_THRESHOLD;
+    if (unlikely(n < threshold || (misalign & 1))) {
+        __aeabi_memcpy(dest, src, n);
+        return;
+    }
+
+    if (misalign & 2) {
+        /* Copy byte head to half align */
+        size_t head = (u32) dest & 1;
+        __aeabi_memcpy(dest, src, head);
+
+        const size_t body = (n - head) & ~1u;
+        dma3_transfer((char*) dest + head, (const char*) src + head, body >> 1, 0);
+
+        head += body;
+        __aeabi_memcpy((char*) dest + head, (const char*) src + head, n - head);
+        return;
+    }
+
+    /* Copy byte & half head to word align */
+    const size_t head = (4 - (u32) dest) & 3;
+    __aeabi_memcpy(dest, src, head);
+
+    __agbabi_dma_memcpy4((char*) dest + head, (const char*) src + head, n - head);
+}
+
+void __agbabi_dma_memcpy4(void* __restrict__ dest, const void* __restrict__ src, size_t n) {
+    const size_t body = n & ~3u;
+
+    dma3_transfer(dest, src, body >> 2, DMA_32BIT);
+    __aeabi_memcpy((char*) dest + body, (const char*) src + body, n & 3);
+}
+
+void __agbabi_dma_memset(void* dest, size_t n, int c) {
+    /*
+     * Fill DMA re-reads its fixed source every unit and never beat __aeabi_memset4
+     * (256 bytes into ewram: 637 vs 430 cycles, 8KiB: 14525 vs 13326), so this sets with the CPU
+     * __aeabi_memset uses 8-bit writes, which VRAM ignores or duplicates
+     */
+    __agbabi_vram_memset(dest, n, c);
+}
+
+void __agbabi_dma_memset4(void* dest, size_t n, int c) {
+    /* DMA reads the fill value from memory */
+    volatile u32 fill = (u32) (c & 0xff) * 0x01010101u;
+    const size_t body = n & ~3u;
+
+    dma3_transfer(dest, (const void*) &fill, body >> 2, DMA_32BIT | DMA_SRC_FIXED);
+    __agbabi_vram_memset((char*) dest + body, n & 3, c);
+}
+
+static void dma3_transfer(void* dest, const void* src, size_t count, u32 control) {
+    /* Flush pending CPU writes to src before the DMA reads them */
+    __asm__ volatile ("" ::: "memory");
+
+    const u32 srcStep = (control & DMA_SRC_FIXED) ? 0 : (control & DMA_32BIT) ? 4 : 2;
+    const u32 dstStep = (control & DMA_32BIT) ? 4 : 2;
+
+    /* Split transfers above the 16-bit DMA3 count limit */
+    while (count) {
+        const u32 chunk = likely(count < DMA3_MAX_COUNT) ? count : DMA3_MAX_COUNT;
+
+        *ADDR_DMA3SAD = src;
+        *ADDR_DMA3DAD = dest;
+        *ADDR_DMA3CNT = (u16) chunk | ((control | DMA_ENABLE) << 16);
+
+        /* CPU is halted until the immediate transfer completes */
+        src = (const char*) src + chunk * srcStep;
+        dest = (char*) dest + chunk * dstStep;
+        count -= chunk;
+    }
+
+    __asm__ volatile ("" ::: "memory");
+}
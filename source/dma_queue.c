@@ -0,0 +1,178 @@
+/*
+===============================================================================
+
+ Support:
+    __agbabi_dma_queue_submit, __agbabi_dma_queue_irq,
+    __agbabi_dma_queue_busy, __agbabi_dma_queue_stats
+
+ Copyright (C) 2021-2023 agbabi contributors
+ For conditions of distribution and use, see copyright notice in LICENSE.md
+
+===============================================================================
+*/
+
+#include <agbabi.h>
+
+typedef unsigned short u16;
+typedef volatile u16 vu16;
+typedef unsigned int u32;
+typedef volatile u32 vu32;
+
+#define ADDR_IE     ((vu16*) 0x4000200)
+#define ADDR_IME    ((vu16*) 0x4000208)
+#define ADDR_DMA(N) ((vu32*) (0x40000B0 + (N) * 12))
+
+#define IRQ_DMA(N)  (0x0100 << (N))
+#define IRQ_DMA_ALL (0x0f00)
+
+#define DMA_32BIT       (0x0400)
+#define DMA_IRQ         (0x4000)
+#define DMA_ENABLE      (0x8000)
+
+/* Largest unit count for DMA0-2 (14-bit) and DMA3 (16-bit) */
+#define DMA_MAX_COUNT(N) ((N) == 3 ? 0x10000u : 0x4000u)
+
+#define QUEUE_LEN (32u)
+
+#define unlikely(x) __builtin_expect(!!(x), 0)
+
+static struct {
+    const __agbabi_dma_desc_t* desc[QUEUE_LEN];
+    u32 head;
+    u32 tail;
+    u32 offset; /* Bytes of desc[head] already transferred */
+    u32 active; /* IRQ flag of the transfer in flight */
+    u32 unit; /* Bytes per unit of the transfer in flight */
+    __agbabi_dma_queue_stats_t stats;
+} queue;
+
+static void queue_pop(void);
+static void queue_start(void);
+
+size_t __agbabi_dma_queue_submit(const __agbabi_dma_desc_t* desc, size_t count) {
+    const u16 ime = *ADDR_IME;
+    *ADDR_IME = 0;
+
+    size_t submitted = 0;
+    for (; submitted < count; ++submitted) {
+        /* 16-bit DMA rounds odd addresses down and drops an odd tail byte */
+        if (unlikely((desc[submitted].n | (u32) desc[submitted].src | (u32) desc[submitted].dest) & 1)) {
+            break;
+        }
+
+        if (unlikely(queue.stats.depth == QUEUE_LEN)) {
+            ++queue.stats.stalls;
+            break;
+        }
+
+        queue.desc[queue.tail] = &desc[submitted];
+        queue.tail = (queue.tail + 1) % QUEUE_LEN;
+
+        if (++queue.stats.depth > queue.stats.max_depth) {
+            queue.stats.max_depth = queue.stats.depth;
+        }
+    }
+
+    queue_start();
+
+    *ADDR_IME = ime;
+    return submitted;
+}
+
+int __agbabi_dma_queue_irq(int irqFlags) {
+    if (!(irqFlags & (int) queue.active)) {
+        return 0;
+    }
+
+    const __agbabi_dma_desc_t* desc = queue.desc[queue.head];
+    const u32 max = DMA_MAX_COUNT(desc->channel) * queue.unit;
+    const u32 remaining = desc->n - queue.offset;
+
+    queue.active = 0;
+
+    if (remaining > max) {
+        /* Continue a transfer that was split at the count limit */
+        queue.offset += max;
+        queue_start();
+        return 0;
+    }
+
+    queue_pop();
+
+    /* Start the next transfer before the callback, unless zero-length descriptors complete first */
+    if (queue.stats.depth && queue.desc[queue.head]->n) {
+        queue_start();
+    }
+
+    if (desc->callback) {
+        desc->callback(desc);
+    }
+
+    queue_start();
+
+    if (queue.active == (u32) IRQ_DMA(desc->channel)) {
+        return 0;
+    }
+
+    /* __agbabi_irq_user restores REG_IE from the handled flags, so it must also drop this bit */
+    *ADDR_IE &= (u16) ~IRQ_DMA(desc->channel);
+    return IRQ_DMA(desc->channel);
+}
+
+int __agbabi_dma_queue_busy(void) {
+    /* Depth is decremented by the IRQ handler */
+    return *(volatile unsigned int*) &queue.stats.depth != 0;
+}
+
+__agbabi_dma_queue_stats_t __agbabi_dma_queue_stats(void) {
+    const u16 ime = *ADDR_IME;
+    *ADDR_IME = 0;
+    const __agbabi_dma_queue_stats_t stats = queue.stats;
+    *ADDR_IME = ime;
+    return stats;
+}
+
+void queue_pop(void) {
+    queue.offset = 0;
+    queue.head = (queue.head + 1) % QUEUE_LEN;
+    --queue.stats.depth;
+    ++queue.stats.completed;
+}
+
+void queue_start(void) {
+    while (!queue.active && queue.stats.depth) {
+        const __agbabi_dma_desc_t* desc = queue.desc[queue.head];
+
+        if (unlikely(desc->n == 0)) {
+            /* A count of 0 is the maximum count, so complete without starting DMA */
+            queue_pop();
+            if (desc->callback) {
+                desc->callback(desc);
+            }
+            continue;
+        }
+
+        const u32 src = (u32) desc->src + queue.offset;
+        const u32 dest = (u32) desc->dest + queue.offset;
+        const u32 remaining = desc->n - queue.offset;
+
+        const int wide = ((src | dest | remaining) & 3) == 0;
+        queue.unit = wide ? 4 : 2;
+
+        u32 count = remaining / queue.unit;
+        if (count > DMA_MAX_COUNT(desc->channel)) {
+            count = DMA_MAX_COUNT(desc->channel);
+        }
+
+        const u32 control = DMA_ENABLE | DMA_IRQ | ((u32) (desc->timing & 3) << 12) | (wide ? DMA_32BIT : 0);
+
+        *ADDR_IE |= (u16) IRQ_DMA(desc->channel);
+
+        vu32* dma = ADDR_DMA(desc->channel);
+        dma[0] = src;
+        dma[1] = dest;
+        dma[2] = (u16) count | (control << 16);
+
+        queue.active = IRQ_DMA(desc->channel);
+    }
+}
@@ -0,0 +1,1102 @@
+@===============================================================================
+@
+@ ABI:
+@    __aeabi_dadd, __aeabi_dsub, __aeabi_drsub, __aeabi_dmul, __aeabi_ddiv,
+@    __aeabi_i2d, __aeabi_ui2d, __aeabi_l2d, __aeabi_ul2d,
+@    __aeabi_d2iz, __aeabi_d2uiz, __aeabi_d2lz, __aeabi_d2ulz,
+@    __aeabi_f2d, __aeabi_d2f,
+@    __aeabi_dcmpeq, __aeabi_dcmplt, __aeabi_dcmple, __aeabi_dcmpge,
+@    __aeabi_dcmpgt, __aeabi_dcmpun
+@
+@ IEEE 754 double precision, rounding to nearest even
+@ Assembling with AGBABI_FAST_MATH defined treats denormal inputs as zero,
+@ flushes denormal results to zero, and skips infinity and NaN inputs
+@
+@ Copyright (C) 2021-2023 agbabi contributors
+@ For conditions of distribution and use, see copyright notice in LICENSE.md
+@
+@===============================================================================
+
+.syntax unified
+.include "macros.inc"
+
+@ Shifts \hi:\lo left until bit 31 of \hi is set, subtracting the shift from \e
+@ \hi:\lo must not be zero
+.macro dnorm hi, lo, e
+    cmp     \hi, #0
+    moveq   \hi, \lo
+    moveq   \lo, #0
+    subeq   \e, \e, #32
+    cmp     \hi, #1 << 16
+    lsllo   \hi, \hi, #16
+    orrlo   \hi, \hi, \lo, lsr #16
+    lsllo   \lo, \lo, #16
+    sublo   \e, \e, #16
+    cmp     \hi, #1 << 24
+    lsllo   \hi, \hi, #8
+    orrlo   \hi, \hi, \lo, lsr #24
+    lsllo   \lo, \lo, #8
+    sublo   \e, \e, #8
+    cmp     \hi, #1 << 28
+    lsllo   \hi, \hi, #4
+    orrlo   \hi, \hi, \lo, lsr #28
+    lsllo   \lo, \lo, #4
+    sublo   \e, \e, #4
+    cmp     \hi, #1 << 30
+    lsllo   \hi, \hi, #2
+    orrlo   \hi, \hi, \lo, lsr #30
+    lsllo   \lo, \lo, #2
+    sublo   \e, \e, #2
+    cmp     \hi, #1 << 31
+    lsllo   \hi, \hi, #1
+    orrlo   \hi, \hi, \lo, lsr #31
+    lsllo   \lo, \lo, #1
+    sublo   \e, \e, #1
+.endm
+
+@ Rounds to nearest even, packs the result into r0:r1, and returns
+@ r0:r1 = mantissa with its leading bit at bit 63, r12 = sticky bits below r0
+@ r2 = biased exponent - 1, r3 = sign (bit 31 only)
+.macro dpack
+    @ Exponents near the top, or below the bottom
+    cmp     r2, #0x7f0
+    bhs     .Ldpack_range\@
+
+.Ldpack_normal\@:
+    add     r3, r3, r2, lsl #20
+    add     r3, r3, r1, lsr #11
+    lsl     r2, r0, #21
+    lsr     r0, r0, #11
+    orr     r0, r0, r1, lsl #21
+    mov     r1, r3
+
+    @ Carry is the guard bit, r2 keeps the rest of the sticky bits
+    @ Rounding up may carry into the exponent, reaching infinity
+    movs    r2, r2, lsl #1
+    bxcc    lr
+    orrs    r12, r12, r2
+    andeq   r2, r0, #1              @ halfway rounds to even
+    movne   r2, #1
+    adds    r0, r0, r2
+    adc     r1, r1, #0
+    bx      lr
+
+.Ldpack_range\@:
+    cmp     r2, #0
+    blt     .Ldpack_underflow\@
+    add     r2, r2, #2
+    cmp     r2, #0x800
+    sub     r2, r2, #2
+    blo     .Ldpack_normal\@
+    orr     r1, r3, #0x7f000000
+    orr     r1, r1, #0x00f00000
+    mov     r0, #0
+    bx      lr
+
+.Ldpack_underflow\@:
+.ifdef AGBABI_FAST_MATH
+    mov     r1, r3
+    mov     r0, #0
+    bx      lr
+.else
+    @ Denormal, r2 = 1 - biased exponent is the extra right shift
+    rsb     r2, r2, #0
+    cmp     r2, #54
+    movhs   r1, r3
+    movhs   r0, #0
+    bxhs    lr
+
+    push    {r4}
+    subs    r4, r2, #32
+    orrhs   r12, r12, r0
+    movhs   r0, r1
+    movhs   r1, #0
+    movhs   r2, r4
+    rsb     r4, r2, #32
+    orr     r12, r12, r0, lsl r4
+    lsr     r0, r0, r2
+    orr     r0, r0, r1, lsl r4
+    lsr     r1, r1, r2
+    pop     {r4}
+    mov     r2, #0
+    b       .Ldpack_normal\@
+.endif
+.endm
+
+@ Branches to \unordered if either r0:r1 or r2:r3 is NaN, clobbering r12
+.macro dcmp_nan unordered
+.ifndef AGBABI_FAST_MATH
+    @ r12 = high word << 1 | (low word != 0), NaN is above 0xffe00000
+    cmp     r0, #1
+    adc     r12, r1, r1
+    cmn     r12, #0x00200000
+    bhi     \unordered
+    cmp     r2, #1
+    adc     r12, r3, r3
+    cmn     r12, #0x00200000
+    bhi     \unordered
+.endif
+.endm
+
+@ Converts r0:r1 and r2:r3 to integers that order like the doubles, with +0 and -0 equal
+@ Branches to \unordered if either is NaN
+.macro dcmp_ordered unordered
+    dcmp_nan \unordered
+    orr     r12, r0, r2
+    orr     r12, r12, r1, lsl #1
+    orrs    r12, r12, r3, lsl #1
+    moveq   r1, r3
+
+    @ Negative doubles order backwards, flip all but the sign
+    asr     r12, r1, #31
+    eor     r0, r0, r12
+    eor     r1, r1, r12, lsr #1
+    asr     r12, r3, #31
+    eor     r2, r2, r12
+    eor     r3, r3, r12, lsr #1
+.endm
+
+    .arm
+    .align 2
+
+    .section .iwram.__aeabi_dadd, "ax", %progbits
+    .global __aeabi_drsub
+    .type __aeabi_drsub, %function
+__aeabi_drsub:
+    eor     r1, r1, #0x80000000
+    b       __aeabi_dadd
+
+    .global __aeabi_dsub
+    .type __aeabi_dsub, %function
+__aeabi_dsub:
+    eor     r3, r3, #0x80000000
+    @ Fallthrough
+
+    .global __aeabi_dadd
+    .type __aeabi_dadd, %function
+__aeabi_dadd:
+    push    {r4-r7}
+
+    @ Order the operands so that |a| >= |b|
+    lsl     r4, r1, #1
+    lsl     r5, r3, #1
+    cmp     r4, r5
+    cmpeq   r0, r2
+    blo     .Ldadd_swap
+
+.Ldadd_ordered:
+.ifndef AGBABI_FAST_MATH
+    cmn     r4, #0x00200000
+    bcs     .Ldadd_inf_nan
+.endif
+
+    lsr     r4, r4, #21
+    lsrs    r5, r5, #21
+    beq     .Ldadd_small
+
+    @ b is below half an ulp of a
+    sub     r5, r4, r5
+    cmp     r5, #53
+    bhi     .Ldadd_return
+
+    @ r4 = sign of a | exponent of a, r6 = signs differ in bit 31
+    and     r6, r1, #0x80000000
+    orr     r4, r4, r6
+    eor     r6, r1, r3
+
+    @ Mantissas with their leading bit at bit 63
+    lsl     r1, r1, #11
+    orr     r1, r1, r0, lsr #21
+    orr     r1, r1, #0x80000000
+    lsl     r0, r0, #11
+    lsl     r3, r3, #11
+    orr     r3, r3, r2, lsr #21
+    orr     r3, r3, #0x80000000
+    lsl     r2, r2, #11
+
+.Ldadd_aligned:
+    @ Shift b right by the exponent difference r5, r12 = bits shifted out
+    subs    r7, r5, #32
+    bhs     .Ldadd_shift_word
+    rsb     r7, r5, #32
+    lsl     r12, r2, r7
+    lsr     r2, r2, r5
+    orr     r2, r2, r3, lsl r7
+    lsr     r3, r3, r5
+
+.Ldadd_shifted:
+    cmp     r6, #0
+    bmi     .Ldadd_subtract
+
+    adds    r0, r0, r2
+    adcs    r1, r1, r3
+    bcc     .Ldadd_sign
+
+    @ Carry out, shift it back in and increase the exponent
+    orr     r12, r12, r0, lsl #31
+    movs    r1, r1, rrx
+    rrx     r0, r0
+    add     r4, r4, #1
+
+.Ldadd_sign:
+    and     r3, r4, #0x80000000
+    bic     r2, r4, #0x80000000
+    sub     r2, r2, #1
+    pop     {r4-r7}
+
+.Ldadd_round:
+    dpack
+
+.Ldadd_subtract:
+    @ r0:r1:r12 = a - b, r12 only keeps the top bits shifted out of b
+    rsbs    r12, r12, #0
+    sbcs    r0, r0, r2
+    sbc     r1, r1, r3
+    and     r3, r4, #0x80000000
+    bic     r2, r4, #0x80000000
+    sub     r2, r2, #1
+    pop     {r4-r7}
+
+    @ Equal magnitudes give +0
+    cmp     r1, #0
+    bmi     .Ldadd_round
+    cmpeq   r0, #0
+    bxeq    lr
+
+    @ Only the first shift can take a bit from r12, as the result is at least 2^62 when r12 is non-zero
+    adds    r12, r12, r12
+    adcs    r0, r0, r0
+    adc     r1, r1, r1
+    sub     r2, r2, #1
+    dnorm   r1, r0, r2
+    b       .Ldadd_round
+
+.Ldadd_shift_word:
+    @ r7 = exponent difference - 32, jam bits below r12 into its lowest bit
+    rsb     r5, r7, #32
+    lsls    r12, r2, r5
+    lsr     r12, r2, r7
+    orr     r12, r12, r3, lsl r5
+    orrne   r12, r12, #1
+    lsr     r2, r3, r7
+    mov     r3, #0
+    b       .Ldadd_shifted
+
+.Ldadd_swap:
+    mov     r12, r0
+    mov     r0, r2
+    mov     r2, r12
+    mov     r12, r1
+    mov     r1, r3
+    mov     r3, r12
+    mov     r12, r4
+    mov     r4, r5
+    mov     r5, r12
+    b       .Ldadd_ordered
+
+.Ldadd_small:
+    @ b is zero, or a denormal
+.ifndef AGBABI_FAST_MATH
+    orrs    r12, r2, r3, lsl #1
+    bne     .Ldadd_denormal
+.endif
+    @ Return a, unless both are zero and only one is negative
+    orrs    r12, r0, r1, lsl #1
+    andeq   r1, r1, r3
+
+.Ldadd_return:
+    pop     {r4-r7}
+    bx      lr
+
+.ifndef AGBABI_FAST_MATH
+.Ldadd_denormal:
+    cmp     r4, #0
+    beq     .Ldadd_denormals
+
+    @ b has an exponent of 1 and no leading bit
+    sub     r5, r4, #1
+    cmp     r5, #53
+    bhi     .Ldadd_return
+    and     r6, r1, #0x80000000
+    orr     r4, r4, r6
+    eor     r6, r1, r3
+    lsl     r1, r1, #11
+    orr     r1, r1, r0, lsr #21
+    orr     r1, r1, #0x80000000
+    lsl     r0, r0, #11
+    lsl     r3, r3, #11
+    orr     r3, r3, r2, lsr #21
+    lsl     r2, r2, #11
+    b       .Ldadd_aligned
+
+.Ldadd_denormals:
+    @ Both denormal, the sum is exact, and a carry makes a normal
+    teq     r1, r3
+    bic     r3, r3, #0x80000000
+    bmi     .Ldadd_denormals_subtract
+    adds    r0, r0, r2
+    adc     r1, r1, r3
+    b       .Ldadd_return
+
+.Ldadd_denormals_subtract:
+    subs    r0, r0, r2
+    sbc     r1, r1, r3
+    orrs    r12, r0, r1, lsl #1
+    moveq   r1, #0
+    b       .Ldadd_return
+
+.Ldadd_inf_nan:
+    @ a is the larger, so NaN if either is NaN
+    orrs    r12, r0, r1, lsl #12
+    orrne   r1, r1, #0x00080000
+    bne     .Ldadd_return
+
+    @ Infinity, minus infinity is NaN
+    cmp     r4, r5
+    cmpeq   r0, r2
+    bne     .Ldadd_return
+    teq     r1, r3
+    bpl     .Ldadd_return
+    mov     r1, #0x7f000000
+    orr     r1, r1, #0x00f80000
+    mov     r0, #0
+    b       .Ldadd_return
+.endif
+
+    .section .iwram.__aeabi_dmul, "ax", %progbits
+    .global __aeabi_dmul
+    .type __aeabi_dmul, %function
+__aeabi_dmul:
+    push    {r4-r7}
+
+    lsl     r4, r1, #1
+    lsl     r5, r3, #1
+.ifndef AGBABI_FAST_MATH
+    cmn     r4, #0x00200000
+    cmncc   r5, #0x00200000
+    bcs     .Ldmul_inf_nan
+.endif
+
+    @ r4, r5 = exponents
+    lsrs    r4, r4, #21
+    lsrsne  r5, r5, #21
+    beq     .Ldmul_zero_or_denormal
+
+    add     r4, r4, r5
+    eor     r5, r1, r3
+    and     r5, r5, #0x80000000
+
+    @ Mantissas with their leading bit at bit 63
+    lsl     r1, r1, #11
+    orr     r1, r1, r0, lsr #21
+    orr     r1, r1, #0x80000000
+    lsl     r0, r0, #11
+    lsl     r3, r3, #11
+    orr     r3, r3, r2, lsr #21
+    orr     r3, r3, #0x80000000
+    lsl     r2, r2, #11
+
+.Ldmul_mantissa:
+    @ r2:r12:r7:r6 = product, in [2^126, 2^128)
+    umull   r6, r7, r0, r2
+    mov     r12, #0
+    umlal   r7, r12, r1, r2
+    mov     r2, #0
+    umlal   r7, r2, r0, r3
+    adds    r12, r12, r2
+    mov     r2, #0
+    adc     r2, r2, #0
+    umlal   r12, r2, r1, r3
+
+    @ Biased exponent - 1 = ea + eb - 1023, normalize a product below 2^127
+    sub     r4, r4, #0x400
+    add     r4, r4, #1
+    cmp     r2, #0
+    bmi     .Ldmul_normalized
+    adds    r7, r7, r7
+    adcs    r12, r12, r12
+    adc     r2, r2, r2
+    sub     r4, r4, #1
+
+.Ldmul_normalized:
+    orr     r6, r6, r7
+    mov     r0, r12
+    mov     r1, r2
+    mov     r12, r6
+    mov     r2, r4
+    mov     r3, r5
+    pop     {r4-r7}
+
+    dpack
+
+.Ldmul_zero_or_denormal:
+    eor     r12, r1, r3
+    and     r12, r12, #0x80000000
+.ifdef AGBABI_FAST_MATH
+    @ Zero or denormal
+    mov     r1, r12
+    mov     r0, #0
+    pop     {r4-r7}
+    bx      lr
+.else
+    lsl     r4, r1, #1
+    lsl     r5, r3, #1
+
+    @ Zero
+    orrs    r6, r4, r0
+    orrsne  r6, r5, r2
+    moveq   r1, r12
+    moveq   r0, #0
+    beq     .Ldmul_return
+
+    @ Denormals have an exponent of 1 and no leading bit
+    lsrs    r4, r4, #21
+    lsl     r1, r1, #11
+    orr     r1, r1, r0, lsr #21
+    lsl     r0, r0, #11
+    orrne   r1, r1, #0x80000000
+    moveq   r4, #1
+    dnorm   r1, r0, r4
+
+    lsrs    r5, r5, #21
+    lsl     r3, r3, #11
+    orr     r3, r3, r2, lsr #21
+    lsl     r2, r2, #11
+    orrne   r3, r3, #0x80000000
+    moveq   r5, #1
+    dnorm   r3, r2, r5
+
+    add     r4, r4, r5
+    mov     r5, r12
+    b       .Ldmul_mantissa
+
+.Ldmul_inf_nan:
+    eor     r12, r1, r3
+    and     r12, r12, #0x80000000
+
+    @ NaN, r6 = 0xffe00000 is the high word of infinity << 1
+    mov     r6, #0xff000000
+    orr     r6, r6, #0x00e00000
+    cmp     r4, r6
+    cmpeq   r0, #0
+    orrhi   r1, r1, #0x00080000
+    bhi     .Ldmul_return
+    cmp     r5, r6
+    cmpeq   r2, #0
+    orrhi   r1, r3, #0x00080000
+    movhi   r0, r2
+    bhi     .Ldmul_return
+
+    @ Infinity, times zero is NaN
+    orrs    r7, r4, r0
+    orrsne  r7, r5, r2
+    mov     r0, #0
+    moveq   r1, #0x7f000000
+    orreq   r1, r1, #0x00f80000
+    orrne   r1, r12, #0x7f000000
+    orrne   r1, r1, #0x00f00000
+
+.Ldmul_return:
+    pop     {r4-r7}
+    bx      lr
+.endif
+
+    .section .iwram.__aeabi_ddiv, "ax", %progbits
+    .global __aeabi_ddiv
+    .type __aeabi_ddiv, %function
+__aeabi_ddiv:
+    push    {r4-r8}
+
+    lsl     r4, r1, #1
+    lsl     r5, r3, #1
+.ifndef AGBABI_FAST_MATH
+    cmn     r4, #0x00200000
+    cmncc   r5, #0x00200000
+    bcs     .Lddiv_inf_nan
+.endif
+
+    @ r4, r5 = exponents
+    lsrs    r4, r4, #21
+    lsrsne  r5, r5, #21
+    beq     .Lddiv_zero_or_denormal
+
+    sub     r4, r4, r5
+    eor     r5, r1, r3
+    and     r5, r5, #0x80000000
+
+    @ Mantissas with their leading bit at bit 52
+    lsl     r1, r1, #11
+    lsr     r1, r1, #11
+    orr     r1, r1, #0x00100000
+    lsl     r3, r3, #11
+    lsr     r3, r3, #11
+    orr     r3, r3, #0x00100000
+
+.Lddiv_mantissa:
+    @ Make the numerator at least the denominator, so the quotient is in [1, 2)
+    cmp     r1, r3
+    cmpeq   r0, r2
+    bhs     .Lddiv_ordered
+    adds    r0, r0, r0
+    adc     r1, r1, r1
+    sub     r4, r4, #1
+
+.Lddiv_ordered:
+    @ Biased exponent - 1 = ea - eb + 1022
+    add     r4, r4, #0x400
+    sub     r4, r4, #2
+
+    @ The first quotient bit is 1, then 52 mantissa bits and a guard bit
+    @ r6 = high 22 bits, r12 = low 32 bits
+    subs    r0, r0, r2
+    sbc     r1, r1, r3
+    mov     r6, #1
+    .rept 21
+    adds    r0, r0, r0
+    adc     r1, r1, r1
+    subs    r7, r0, r2
+    sbcs    r8, r1, r3
+    movcs   r0, r7
+    movcs   r1, r8
+    adc     r6, r6, r6
+    .endr
+    .rept 32
+    adds    r0, r0, r0
+    adc     r1, r1, r1
+    subs    r7, r0, r2
+    sbcs    r8, r1, r3
+    movcs   r0, r7
+    movcs   r1, r8
+    adc     r12, r12, r12
+    .endr
+
+    @ The remainder is the sticky bits
+    orr     r7, r0, r1
+    lsl     r1, r6, #10
+    orr     r1, r1, r12, lsr #22
+    lsl     r0, r12, #10
+    mov     r12, r7
+    mov     r2, r4
+    mov     r3, r5
+    pop     {r4-r8}
+
+    dpack
+
+.Lddiv_zero_or_denormal:
+    eor     r12, r1, r3
+    and     r12, r12, #0x80000000
+    lsl     r4, r1, #1
+    lsl     r5, r3, #1
+.ifdef AGBABI_FAST_MATH
+    @ Zero divided is zero, division by zero is infinity
+    mov     r0, #0
+    lsrs    r4, r4, #21
+    moveq   r1, r12
+    orrne   r1, r12, #0x7f000000
+    orrne   r1, r1, #0x00f00000
+    pop     {r4-r8}
+    bx      lr
+.else
+    @ Zero divided by zero is NaN, otherwise division by zero is infinity
+    orrs    r6, r5, r2
+    bne     .Lddiv_nonzero
+    orrs    r6, r4, r0
+    mov     r0, #0
+    moveq   r1, #0x7f000000
+    orreq   r1, r1, #0x00f80000
+    orrne   r1, r12, #0x7f000000
+    orrne   r1, r1, #0x00f00000
+    b       .Lddiv_return
+
+.Lddiv_nonzero:
+    @ Zero divided is zero
+    orrs    r6, r4, r0
+    moveq   r1, r12
+    beq     .Lddiv_return
+
+    @ Denormals have an exponent of 1 and no leading bit
+    lsrs    r4, r4, #21
+    lsl     r1, r1, #11
+    orr     r1, r1, r0, lsr #21
+    lsl     r0, r0, #11
+    orrne   r1, r1, #0x80000000
+    moveq   r4, #1
+    dnorm   r1, r0, r4
+    lsr     r0, r0, #11
+    orr     r0, r0, r1, lsl #21
+    lsr     r1, r1, #11
+
+    lsrs    r5, r5, #21
+    lsl     r3, r3, #11
+    orr     r3, r3, r2, lsr #21
+    lsl     r2, r2, #11
+    orrne   r3, r3, #0x80000000
+    moveq   r5, #1
+    dnorm   r3, r2, r5
+    lsr     r2, r2, #11
+    orr     r2, r2, r3, lsl #21
+    lsr     r3, r3, #11
+
+    sub     r4, r4, r5
+    mov     r5, r12
+    b       .Lddiv_mantissa
+
+.Lddiv_inf_nan:
+    eor     r12, r1, r3
+    and     r12, r12, #0x80000000
+
+    @ NaN, r6 = 0xffe00000 is the high word of infinity << 1
+    mov     r6, #0xff000000
+    orr     r6, r6, #0x00e00000
+    cmp     r4, r6
+    cmpeq   r0, #0
+    orrhi   r1, r1, #0x00080000
+    bhi     .Lddiv_return
+    cmp     r5, r6
+    cmpeq   r2, #0
+    orrhi   r1, r3, #0x00080000
+    movhi   r0, r2
+    bhi     .Lddiv_return
+
+    @ Infinity divided by infinity is NaN, otherwise infinity
+    @ Divided by infinity is zero
+    mov     r0, #0
+    cmp     r4, r6
+    bne     .Lddiv_by_inf
+    cmp     r5, r6
+    moveq   r1, #0x7f000000
+    orreq   r1, r1, #0x00f80000
+    orrne   r1, r12, #0x7f000000
+    orrne   r1, r1, #0x00f00000
+    b       .Lddiv_return
+
+.Lddiv_by_inf:
+    mov     r1, r12
+
+.Lddiv_return:
+    pop     {r4-r8}
+    bx      lr
+.endif
+
+    .section .iwram.__aeabi_i2d, "ax", %progbits
+    .global __aeabi_i2d
+    .type __aeabi_i2d, %function
+__aeabi_i2d:
+    ands    r3, r0, #0x80000000
+    rsbne   r0, r0, #0
+    b       .Li2d
+
+    .global __aeabi_ui2d
+    .type __aeabi_ui2d, %function
+__aeabi_ui2d:
+    mov     r3, #0
+
+.Li2d:
+    cmp     r0, #0
+    moveq   r1, #0
+    bxeq    lr
+
+    @ Biased exponent - 1 with the leading bit at bit 31, always exact
+    mov     r2, #0x400
+    add     r2, r2, #29
+    fnorm   r0, r2
+    add     r1, r3, r2, lsl #20
+    add     r1, r1, r0, lsr #11
+    lsl     r0, r0, #21
+    bx      lr
+
+    @ libgcc defines these alongside __aeabi_dadd, so they are needed to replace it
+    .section .iwram.__aeabi_l2d, "ax", %progbits
+    .global __aeabi_l2d
+    .type __aeabi_l2d, %function
+__aeabi_l2d:
+    ands    r3, r1, #0x80000000
+    beq     .Ll2d
+    rsbs    r0, r0, #0
+    rsc     r1, r1, #0
+    b       .Ll2d
+
+    .global __aeabi_ul2d
+    .type __aeabi_ul2d, %function
+__aeabi_ul2d:
+    mov     r3, #0
+
+.Ll2d:
+    orrs    r2, r0, r1
+    bxeq    lr
+
+    @ Biased exponent - 1 with the leading bit at bit 63
+    mov     r2, #0x400
+    add     r2, r2, #61
+    dnorm   r1, r0, r2
+    mov     r12, #0
+
+    dpack
+
+    .section .iwram.__aeabi_d2iz, "ax", %progbits
+    .global __aeabi_d2iz
+    .type __aeabi_d2iz, %function
+__aeabi_d2iz:
+    @ r3 = right shift of the top 32 bits of the mantissa
+    mov     r12, #0x400
+    add     r12, r12, #30
+    lsl     r2, r1, #1
+    subs    r3, r12, r2, lsr #21
+    ble     .Ld2iz_saturate
+
+    @ Below 1 truncates to 0
+    cmp     r3, #32
+    movhs   r0, #0
+    bxhs    lr
+
+    lsl     r12, r1, #11
+    orr     r12, r12, r0, lsr #21
+    orr     r12, r12, #0x80000000
+    lsr     r12, r12, r3
+    cmp     r1, #0
+    rsblt   r0, r12, #0
+    movge   r0, r12
+    bx      lr
+
+.Ld2iz_saturate:
+    @ 2^31 and above saturate
+.ifndef AGBABI_FAST_MATH
+    @ NaN converts to 0
+    cmn     r2, #0x00200000
+    bcc     .Ld2iz_saturate_inf
+    orrs    r12, r0, r1, lsl #12
+    movne   r0, #0
+    bxne    lr
+.Ld2iz_saturate_inf:
+.endif
+    mvn     r0, #0x80000000
+    add     r0, r0, r1, lsr #31
+    bx      lr
+
+    .section .iwram.__aeabi_d2uiz, "ax", %progbits
+    .global __aeabi_d2uiz
+    .type __aeabi_d2uiz, %function
+__aeabi_d2uiz:
+    @ Negative truncates to 0
+    lsls    r2, r1, #1
+    movcs   r0, #0
+    bxcs    lr
+
+    @ r3 = right shift of the top 32 bits of the mantissa, 2^32 and above saturate
+    mov     r12, #0x400
+    add     r12, r12, #30
+    subs    r3, r12, r2, lsr #21
+    bmi     .Ld2uiz_saturate
+
+    @ Below 1 truncates to 0
+    cmp     r3, #32
+    movhs   r0, #0
+    bxhs    lr
+
+    lsl     r12, r1, #11
+    orr     r12, r12, r0, lsr #21
+    orr     r12, r12, #0x80000000
+    lsr     r0, r12, r3
+    bx      lr
+
+.Ld2uiz_saturate:
+.ifndef AGBABI_FAST_MATH
+    @ NaN converts to 0
+    cmn     r2, #0x00200000
+    bcc     .Ld2uiz_saturate_inf
+    orrs    r12, r0, r1, lsl #12
+    movne   r0, #0
+    bxne    lr
+.Ld2uiz_saturate_inf:
+.endif
+    mvn     r0, #0
+    bx      lr
+
+    .section .iwram.__aeabi_d2lz, "ax", %progbits
+    .global __aeabi_d2lz
+    .type __aeabi_d2lz, %function
+__aeabi_d2lz:
+    @ r3 = right shift of the 64-bit mantissa
+    mov     r12, #0x400
+    add     r12, r12, #62
+    lsl     r2, r1, #1
+    subs    r3, r12, r2, lsr #21
+    ble     .Ld2lz_saturate
+
+    @ Below 1 truncates to 0
+    cmp     r3, #64
+    movhs   r0, #0
+    movhs   r1, #0
+    bxhs    lr
+
+    @ r2:r0 = mantissa with its leading bit at bit 63, r1 keeps the sign
+    lsl     r2, r1, #11
+    orr     r2, r2, r0, lsr #21
+    orr     r2, r2, #0x80000000
+    lsl     r0, r0, #11
+
+    subs    r12, r3, #32
+    lsrhs   r0, r2, r12
+    movhs   r2, #0
+    bhs     .Ld2lz_sign
+    rsb     r12, r3, #32
+    lsr     r0, r0, r3
+    orr     r0, r0, r2, lsl r12
+    lsr     r2, r2, r3
+
+.Ld2lz_sign:
+    cmp     r1, #0
+    mov     r1, r2
+    bxge    lr
+    rsbs    r0, r0, #0
+    rsc     r1, r1, #0
+    bx      lr
+
+.Ld2lz_saturate:
+    @ 2^63 and above saturate
+.ifndef AGBABI_FAST_MATH
+    @ NaN converts to 0
+    cmn     r2, #0x00200000
+    bcc     .Ld2lz_saturate_inf
+    orrs    r12, r0, r1, lsl #12
+    movne   r0, #0
+    movne   r1, #0
+    bxne    lr
+.Ld2lz_saturate_inf:
+.endif
+    mvn     r0, r1, asr #31
+    mvn     r12, #0x80000000
+    add     r1, r12, r1, lsr #31
+    bx      lr
+
+    .section .iwram.__aeabi_d2ulz, "ax", %progbits
+    .global __aeabi_d2ulz
+    .type __aeabi_d2ulz, %function
+__aeabi_d2ulz:
+    @ Negative truncates to 0
+    lsls    r2, r1, #1
+    movcs   r0, #0
+    movcs   r1, #0
+    bxcs    lr
+
+    @ r3 = right shift of the 64-bit mantissa, 2^64 and above saturate
+    mov     r12, #0x400
+    add     r12, r12, #62
+    subs    r3, r12, r2, lsr #21
+    bmi     .Ld2ulz_saturate
+
+    @ Below 1 truncates to 0
+    cmp     r3, #64
+    movhs   r0, #0
+    movhs   r1, #0
+    bxhs    lr
+
+    @ r2:r0 = mantissa with its leading bit at bit 63
+    lsl     r2, r1, #11
+    orr     r2, r2, r0, lsr #21
+    orr     r2, r2, #0x80000000
+    lsl     r0, r0, #11
+
+    subs    r12, r3, #32
+    lsrhs   r0, r2, r12
+    movhs   r1, #0
+    bxhs    lr
+    rsb     r12, r3, #32
+    lsr     r0, r0, r3
+    orr     r0, r0, r2, lsl r12
+    lsr     r1, r2, r3
+    bx      lr
+
+.Ld2ulz_saturate:
+.ifndef AGBABI_FAST_MATH
+    @ NaN converts to 0
+    cmn     r2, #0x00200000
+    bcc     .Ld2ulz_saturate_inf
+    orrs    r12, r0, r1, lsl #12
+    movne   r0, #0
+    movne   r1, #0
+    bxne    lr
+.Ld2ulz_saturate_inf:
+.endif
+    mvn     r0, #0
+    mvn     r1, #0
+    bx      lr
+
+    .section .iwram.__aeabi_f2d, "ax", %progbits
+    .global __aeabi_f2d
+    .type __aeabi_f2d, %function
+__aeabi_f2d:
+    and     r3, r0, #0x80000000
+    lsl     r2, r0, #1
+.ifndef AGBABI_FAST_MATH
+    cmp     r2, #0xff000000
+    bhs     .Lf2d_inf_nan
+.endif
+    lsrs    r12, r2, #24
+    beq     .Lf2d_zero_or_denormal
+
+    @ Always exact, the exponent bias grows by 896
+    orr     r1, r3, r2, lsr #4
+    add     r1, r1, #0x38000000
+    lsl     r0, r0, #29
+    bx      lr
+
+.Lf2d_zero_or_denormal:
+.ifndef AGBABI_FAST_MATH
+    cmp     r2, #0
+    bne     .Lf2d_denormal
+.endif
+    mov     r1, r3
+    mov     r0, #0
+    bx      lr
+
+.ifndef AGBABI_FAST_MATH
+.Lf2d_denormal:
+    @ Denormals have an exponent of 1 and no leading bit, and become normal
+    lsl     r0, r0, #8
+    mov     r2, #0x380
+    fnorm   r0, r2
+    add     r1, r3, r2, lsl #20
+    add     r1, r1, r0, lsr #11
+    lsl     r0, r0, #21
+    bx      lr
+
+.Lf2d_inf_nan:
+    @ NaN stays NaN, quietened
+    orr     r1, r3, #0x70000000
+    orr     r1, r1, r2, lsr #4
+    lsl     r0, r0, #29
+    cmp     r2, #0xff000000
+    orrhi   r1, r1, #0x00080000
+    bx      lr
+.endif
+
+    .section .iwram.__aeabi_d2f, "ax", %progbits
+    .global __aeabi_d2f
+    .type __aeabi_d2f, %function
+__aeabi_d2f:
+    and     r3, r1, #0x80000000
+    lsl     r2, r1, #1
+.ifndef AGBABI_FAST_MATH
+    cmn     r2, #0x00200000
+    bcs     .Ld2f_inf_nan
+.endif
+
+    @ Float biased exponent - 1 = exponent - 897
+    @ Zero and denormal doubles are below the smallest float, and round to zero
+    lsr     r2, r2, #21
+    sub     r2, r2, #0x380
+    sub     r2, r2, #1
+
+    @ Mantissa with its leading bit at bit 31
+    lsl     r1, r1, #11
+    orr     r1, r1, r0, lsr #21
+    lsl     r12, r0, #11
+    orr     r0, r1, #0x80000000
+
+    fpack
+
+.ifndef AGBABI_FAST_MATH
+.Ld2f_inf_nan:
+    @ NaN stays NaN, quietened, keeping the top of its payload
+    orr     r3, r3, #0x7f000000
+    orrs    r12, r0, r1, lsl #12
+    orr     r0, r3, #0x00800000
+    lslne   r1, r1, #12
+    orrne   r0, r0, r1, lsr #9
+    orrne   r0, r0, #0x00400000
+    bx      lr
+.endif
+
+    .section .iwram.__aeabi_dcmpeq, "ax", %progbits
+    .global __aeabi_dcmpeq
+    .type __aeabi_dcmpeq, %function
+__aeabi_dcmpeq:
+    dcmp_nan .Ldcmpeq_unordered
+
+    @ Equal bits, or +0 and -0
+    orr     r12, r0, r2
+    orr     r12, r12, r1, lsl #1
+    orrs    r12, r12, r3, lsl #1
+    moveq   r1, r3
+    cmp     r0, r2
+    cmpeq   r1, r3
+    moveq   r0, #1
+    movne   r0, #0
+    bx      lr
+.Ldcmpeq_unordered:
+    mov     r0, #0
+    bx      lr
+
+    .section .iwram.__aeabi_dcmplt, "ax", %progbits
+    .global __aeabi_dcmplt
+    .type __aeabi_dcmplt, %function
+__aeabi_dcmplt:
+    dcmp_ordered .Ldcmplt_unordered
+    subs    r12, r0, r2
+    sbcs    r12, r1, r3
+    movlt   r0, #1
+    movge   r0, #0
+    bx      lr
+.Ldcmplt_unordered:
+    mov     r0, #0
+    bx      lr
+
+    .section .iwram.__aeabi_dcmple, "ax", %progbits
+    .global __aeabi_dcmple
+    .type __aeabi_dcmple, %function
+__aeabi_dcmple:
+    dcmp_ordered .Ldcmple_unordered
+    subs    r12, r2, r0
+    sbcs    r12, r3, r1
+    movge   r0, #1
+    movlt   r0, #0
+    bx      lr
+.Ldcmple_unordered:
+    mov     r0, #0
+    bx      lr
+
+    .section .iwram.__aeabi_dcmpge, "ax", %progbits
+    .global __aeabi_dcmpge
+    .type __aeabi_dcmpge, %function
+__aeabi_dcmpge:
+    dcmp_ordered .Ldcmpge_unordered
+    subs    r12, r0, r2
+    sbcs    r12, r1, r3
+    movge   r0, #1
+    movlt   r0, #0
+    bx      lr
+.Ldcmpge_unordered:
+    mov     r0, #0
+    bx      lr
+
+    .section .iwram.__aeabi_dcmpgt, "ax", %progbits
+    .global __aeabi_dcmpgt
+    .type __aeabi_dcmpgt, %function
+__aeabi_dcmpgt:
+    dcmp_ordered .Ldcmpgt_unordered
+    subs    r12, r2, r0
+    sbcs    r12, r3, r1
+    movlt   r0, #1
+    movge   r0, #0
+    bx      lr
+.Ldcmpgt_unordered:
+    mov     r0, #0
+    bx      lr
+
+    .section .iwram.__aeabi_dcmpun, "ax", %progbits
+    .global __aeabi_dcmpun
+    .type __aeabi_dcmpun, %function
+__aeabi_dcmpun:
+    @ r12 = high word << 1 | (low word != 0), NaN is above 0xffe00000
+    cmp     r0, #1
+    adc     r12, r1, r1
+    cmn     r12, #0x00200000
+    movhi   r0, #1
+    bxhi    lr
+    cmp     r2, #1
+    adc     r12, r3, r3
+    cmn     r12, #0x00200000
+    movhi   r0, #1
+    movls   r0, #0
+    bx      lr
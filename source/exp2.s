@@ -0,0 +1,378 @@
+@===============================================================================
+@
+@ Support:
+@    __agbabi_exp2, __agbabi_exp2_array, __agbabi_log2, __agbabi_pow,
+@    __agbabi_pow_array
+@
+@ Copyright (C) 2021-2023 agbabi contributors
+@ For conditions of distribution and use, see copyright notice in LICENSE.md
+@
+@===============================================================================
+
+.syntax unified
+
+@ \rd = Q31 2^(\rf / 2^32), clobbering \rf, \rt0, and \rt1
+@ \rtab points to .Lexp2_table, \rc1-\rc3 hold its coefficients
+@ \rt1 may be the same register as \rtab
+.macro exp2_q31 rd, rf, rtab, rc1, rc2, rc3, rt0, rt1
+    @ Table entry for the top 6 bits, cubic for the remaining 1/64
+    lsr     \rt0, \rf, #26
+    ldr     \rt1, [\rtab, \rt0, lsl #2]
+    bic     \rt0, \rf, #0xfc000000
+    umull   \rf, \rd, \rt0, \rc3
+    add     \rd, \rd, \rc2
+    umull   \rf, \rd, \rt0, \rd
+    add     \rd, \rd, \rc1
+    umull   \rf, \rd, \rt0, \rd
+    umull   \rf, \rt0, \rt1, \rd
+    add     \rd, \rt1, \rt0
+.endm
+
+@ \rd = Q30 log2 of the Q31 mantissa \rm (bit 31 set), clobbering \rm, \rt0, and \rt1
+@ \rtab points to .Llog2_table, \rthird and \rb1 hold its coefficients
+@ \rt0 must be a lower register than \rt1, which may be the same register as \rtab
+.macro log2_q30 rd, rm, rtab, rthird, rb1, rt0, rt1
+    @ Table entry for the top 6 bits, z = m / c - 1 is within 1/129
+    lsl     \rt0, \rm, #1
+    lsr     \rt0, \rt0, #26
+    add     \rt0, \rtab, \rt0, lsl #3
+    ldmia   \rt0, {\rt0, \rt1}
+    umull   \rd, \rt0, \rm, \rt0
+    lsl     \rt0, \rt0, #1
+    orr     \rt0, \rt0, \rd, lsr #31
+
+    @ ln(1 + z) = z + z^2 * (z / 3 - 1 / 2), as Q32
+    smull   \rm, \rd, \rt0, \rthird
+    sub     \rd, \rd, #0x40000000
+    smull   \rm, \rd, \rt0, \rd
+    smull   \rm, \rd, \rt0, \rd
+    add     \rd, \rt0, \rd, lsl #1
+
+    @ log2(c) + ln(1 + z) / ln(2)
+    smull   \rm, \rt0, \rd, \rb1
+    add     \rd, \rt1, \rt0
+.endm
+
+@ Shifts \rx left until bit 31 is set, subtracting the shift from \re
+@ \rx must not be zero
+.macro log2_norm rx, re
+    cmp     \rx, #1 << 16
+    lsllo   \rx, \rx, #16
+    sublo   \re, \re, #16
+    cmp     \rx, #1 << 24
+    lsllo   \rx, \rx, #8
+    sublo   \re, \re, #8
+    cmp     \rx, #1 << 28
+    lsllo   \rx, \rx, #4
+    sublo   \re, \re, #4
+    cmp     \rx, #1 << 30
+    lsllo   \rx, \rx, #2
+    sublo   \re, \re, #2
+    cmp     \rx, #1 << 31
+    lsllo   \rx, \rx, #1
+    sublo   \re, \re, #1
+.endm
+
+    .arm
+    .align 2
+
+    .section .iwram.__agbabi_exp2, "ax", %progbits
+    .global __agbabi_exp2
+    .type __agbabi_exp2, %function
+__agbabi_exp2:
+    @ r1 = right shift of the Q31 result for the Q16 integer part
+    asr     r1, r0, #16
+    rsbs    r1, r1, #15
+    mvnmi   r0, #0
+    bxmi    lr
+    cmp     r1, #32
+    movhi   r0, #0
+    bxhi    lr
+
+    push    {r4-r6}
+    ldr     r3, .Lexp2_table_address
+    ldmia   r3!, {r4-r6}
+    lsl     r0, r0, #16
+    exp2_q31 r2, r0, r3, r4, r5, r6, r12, r3
+    pop     {r4-r6}
+
+    @ Round to nearest, the carry is clear when there is no shift
+    movs    r0, r2, lsr r1
+    adc     r0, r0, #0
+    bx      lr
+
+.Lexp2_table_address:
+    .word   .Lexp2_table
+
+    .section .iwram.__agbabi_exp2_array, "ax", %progbits
+    .global __agbabi_exp2_array
+    .type __agbabi_exp2_array, %function
+__agbabi_exp2_array:
+    @ r0 = dest, r1 = x, r2 = step, r3 = n
+    cmp     r3, #0
+    bxeq    lr
+    push    {r4-r10, lr}
+    ldr     r4, .Lexp2_array_table_address
+    ldmia   r4!, {r5-r7}
+
+.Lexp2_array_loop:
+    asr     r12, r1, #16
+    rsbs    r12, r12, #15
+    mvnmi   r8, #0
+    bmi     .Lexp2_array_store
+    cmp     r12, #32
+    movhi   r8, #0
+    bhi     .Lexp2_array_store
+
+    lsl     lr, r1, #16
+    exp2_q31 r8, lr, r4, r5, r6, r7, r9, r10
+    movs    r8, r8, lsr r12
+    adc     r8, r8, #0
+
+.Lexp2_array_store:
+    str     r8, [r0], #4
+    add     r1, r1, r2
+    subs    r3, r3, #1
+    bne     .Lexp2_array_loop
+
+    pop     {r4-r10, lr}
+    bx      lr
+
+.Lexp2_array_table_address:
+    .word   .Lexp2_table
+
+    .section .iwram.__agbabi_log2, "ax", %progbits
+    .global __agbabi_log2
+    .type __agbabi_log2, %function
+__agbabi_log2:
+    @ log2(0) returns INT_MIN
+    cmp     r0, #0
+    moveq   r0, #0x80000000
+    bxeq    lr
+
+    @ r12 = integer part
+    mov     r12, #15
+    log2_norm r0, r12
+
+    push    {r4-r5}
+    ldr     r2, .Llog2_table_address
+    ldmia   r2!, {r4-r5}
+    log2_q30 r3, r0, r2, r4, r5, r1, r2
+    pop     {r4-r5}
+
+    add     r3, r3, #1 << 13
+    lsl     r0, r12, #16
+    add     r0, r0, r3, asr #14
+    bx      lr
+
+.Llog2_table_address:
+    .word   .Llog2_table
+
+    .section .iwram.__agbabi_pow, "ax", %progbits
+    .global __agbabi_pow
+    .type __agbabi_pow, %function
+__agbabi_pow:
+    @ r0 = x, r1 = y
+    cmp     r0, #0
+    beq     .Lpow_zero
+    push    {r4-r6}
+
+    @ r12 = integer part, r6 = Q30 fraction of log2(x)
+    mov     r12, #15
+    log2_norm r0, r12
+    ldr     r3, .Lpow_log2_table_address
+    ldmia   r3!, {r4-r5}
+    @ The table gives 2^-30 for a mantissa of 1, make powers of two exact
+    cmp     r0, #0x80000000
+    log2_q30 r6, r0, r3, r4, r5, r2, r3
+    moveq   r6, #0
+
+    @ r3:r2 = Q16 y * integer part, beyond 33 bits the fraction cannot bring
+    @ the result back in range
+    smull   r2, r3, r1, r12
+    add     r12, r3, #1
+    cmp     r12, #1
+    bhi     .Lpow_range
+
+    @ r5:r4 = Q46 y * log2(x), r1 = right shift of the Q31 result
+    smull   r4, r5, r1, r6
+    adds    r4, r4, r2, lsl #30
+    lsl     r3, r3, #30
+    orr     r3, r3, r2, lsr #2
+    adc     r5, r5, r3
+    asr     r1, r5, #14
+    rsbs    r1, r1, #15
+    bmi     .Lpow_saturate
+    cmp     r1, #32
+    bhi     .Lpow_underflow
+
+    @ r0 = Q32 fraction
+    lsl     r5, r5, #18
+    orr     r0, r5, r4, lsr #14
+    ldr     r3, .Lpow_exp2_table_address
+    ldmia   r3!, {r4-r6}
+    exp2_q31 r2, r0, r3, r4, r5, r6, r12, r3
+    pop     {r4-r6}
+
+    movs    r0, r2, lsr r1
+    adc     r0, r0, #0
+    bx      lr
+
+.Lpow_range:
+    cmp     r3, #0
+    blt     .Lpow_underflow
+
+.Lpow_saturate:
+    pop     {r4-r6}
+    mvn     r0, #0
+    bx      lr
+
+.Lpow_underflow:
+    pop     {r4-r6}
+    mov     r0, #0
+    bx      lr
+
+.Lpow_zero:
+    @ 0^y is 1 when y is 0, 0 when y is positive, and saturates when y is negative
+    cmp     r1, #0
+    moveq   r0, #0x10000
+    mvnlt   r0, #0
+    bx      lr
+
+.Lpow_log2_table_address:
+    .word   .Llog2_table
+.Lpow_exp2_table_address:
+    .word   .Lexp2_table
+
+    .section .iwram.__agbabi_pow_array, "ax", %progbits
+    .global __agbabi_pow_array
+    .type __agbabi_pow_array, %function
+__agbabi_pow_array:
+    @ r0 = dest, r1 = x, r2 = y, r3 = n
+    cmp     r3, #0
+    bxeq    lr
+    push    {r4-r11, lr}
+
+    @ Both tables and their coefficients do not fit in registers with the
+    @ loop state, so they are kept on the stack
+    @ sp = log2 table, 1 / 3, 1 / ln(2), exp2 table, exp2 coefficients
+    ldr     r4, .Lpow_array_log2_table_address
+    ldmia   r4!, {r5-r6}
+    ldr     r7, .Lpow_array_exp2_table_address
+    ldmia   r7!, {r8-r10}
+    push    {r4-r10}
+
+.Lpow_array_loop:
+    ldr     r7, [r1], #4
+    cmp     r7, #0
+    beq     .Lpow_array_zero
+
+    @ r8 = integer part, r9 = Q30 fraction of log2(x)
+    mov     r8, #15
+    log2_norm r7, r8
+    ldmia   sp, {r4-r6}
+    cmp     r7, #0x80000000
+    log2_q30 r9, r7, r4, r5, r6, r10, r11
+    moveq   r9, #0
+
+    @ Same as __agbabi_pow
+    smull   r10, r11, r2, r8
+    add     r12, r11, #1
+    cmp     r12, #1
+    bhi     .Lpow_array_range
+
+    smull   r4, r5, r2, r9
+    adds    r4, r4, r10, lsl #30
+    lsl     r11, r11, #30
+    orr     r11, r11, r10, lsr #2
+    adc     r5, r5, r11
+    asr     r12, r5, #14
+    rsbs    r12, r12, #15
+    mvnmi   r8, #0
+    bmi     .Lpow_array_store
+    cmp     r12, #32
+    movhi   r8, #0
+    bhi     .Lpow_array_store
+
+    lsl     r5, r5, #18
+    orr     lr, r5, r4, lsr #14
+    add     r4, sp, #12
+    ldmia   r4, {r4-r7}
+    exp2_q31 r8, lr, r4, r5, r6, r7, r9, r10
+    movs    r8, r8, lsr r12
+    adc     r8, r8, #0
+
+.Lpow_array_store:
+    str     r8, [r0], #4
+    subs    r3, r3, #1
+    bne     .Lpow_array_loop
+
+    add     sp, sp, #28
+    pop     {r4-r11, lr}
+    bx      lr
+
+.Lpow_array_range:
+    cmp     r11, #0
+    movlt   r8, #0
+    mvnge   r8, #0
+    b       .Lpow_array_store
+
+.Lpow_array_zero:
+    @ Same as __agbabi_pow for a base of 0
+    cmp     r2, #0
+    moveq   r8, #0x10000
+    movgt   r8, #0
+    mvnlt   r8, #0
+    b       .Lpow_array_store
+
+.Lpow_array_log2_table_address:
+    .word   .Llog2_table
+.Lpow_array_exp2_table_address:
+    .word   .Lexp2_table
+
+    .section .rodata.__agbabi_exp2, "a", %progbits
+    .align 2
+    @ Q32 ln(2), ln(2)^2 / 2, ln(2)^3 / 6
+.Lexp2_table:
+    .word   0xb17217f8, 0x3d7f7bff, 0x0e35846c
+    @ Q31 2^(k / 64)
+    .word   0x80000000, 0x8164d1f4, 0x82cd8699, 0x843a28c4, 0x85aac368, 0x871f6197
+    .word   0x88980e81, 0x8a14d575, 0x8b95c1e4, 0x8d1adf5b, 0x8ea4398b, 0x9031dc43
+    .word   0x91c3d374, 0x935a2b2f, 0x94f4efa9, 0x96942d37, 0x9837f052, 0x99e04593
+    .word   0x9b8d39ba, 0x9d3ed9a7, 0x9ef53261, 0xa0b05110, 0xa2704303, 0xa43515ae
+    .word   0xa5fed6aa, 0xa7cd93b5, 0xa9a15ab5, 0xab7a39b6, 0xad583eea, 0xaf3b78ad
+    .word   0xb123f582, 0xb311c413, 0xb504f334, 0xb6fd91e3, 0xb8fbaf47, 0xbaff5ab2
+    .word   0xbd08a39f, 0xbf1799b6, 0xc12c4cca, 0xc346ccda, 0xc5672a11, 0xc78d74c9
+    .word   0xc9b9bd86, 0xcbec14ff, 0xce248c15, 0xd06333db, 0xd2a81d92, 0xd4f35aac
+    .word   0xd744fccb, 0xd99d15c2, 0xdbfbb798, 0xde60f482, 0xe0ccdeec, 0xe33f8973
+    .word   0xe5b906e7, 0xe8396a50, 0xeac0c6e8, 0xed4f301f, 0xefe4b99c, 0xf281773c
+    .word   0xf5257d15, 0xf7d0df73, 0xfa83b2db, 0xfd3e0c0d
+
+    .section .rodata.__agbabi_log2, "a", %progbits
+    .align 2
+    @ Q31 1 / 3, Q30 1 / ln(2)
+.Llog2_table:
+    .word   0x2aaaaaab, 0x5c551d95
+    @ Q32 1 / c and Q30 log2(c), for c = 1 + (k + 0.5) / 64
+    .word   0xfe03f810, 0x00b7f286, 0xfa232cf2, 0x02239a3b, 0xf6603d98, 0x0389bf57
+    .word   0xf2b9d648, 0x04ea8bf7, 0xef2eb720, 0x0646285c, 0xebbdb2a6, 0x079cbb04
+    .word   0xe865ac7b, 0x08ee68cc, 0xe525982b, 0x0a3b54fd, 0xe1fc780e, 0x0b83a16a
+    .word   0xdee95c4d, 0x0cc76e84, 0xdbeb61ef, 0x0e06db67, 0xd901b203, 0x0f4205f4
+    .word   0xd62b80d6, 0x10790adc, 0xd3680d37, 0x11ac05b3, 0xd0b69fcc, 0x12db10fc
+    .word   0xce168a77, 0x1406463b, 0xcb8727c0, 0x152dbdfc, 0xc907da4f, 0x16518fe4
+    .word   0xc6980c6a, 0x1771d2ba, 0xc4372f85, 0x188e9c73, 0xc1e4bbd6, 0x19a80239
+    .word   0xbfa02fe8, 0x1abe1879, 0xbd691047, 0x1bd0f2ea, 0xbb3ee722, 0x1ce0a492
+    .word   0xb92143fa, 0x1ded3fd4, 0xb70fbb5a, 0x1ef6d673, 0xb509e68b, 0x1ffd799b
+    .word   0xb30f6353, 0x210139e5, 0xb11fd3b8, 0x22022763, 0xaf3addc7, 0x2300519f
+    .word   0xad602b58, 0x23fbc7a6, 0xab8f69e3, 0x24f4980b, 0xa9c84a48, 0x25ead0ec
+    .word   0xa80a80a8, 0x26de7ff7, 0xa655c439, 0x27cfb26f, 0xa4a9cf1e, 0x28be7531
+    .word   0xa3065e40, 0x29aad4b6, 0xa16b312f, 0x2a94dd19, 0x9fd809fe, 0x2b7c9a19
+    .word   0x9e4cad24, 0x2c62171f, 0x9cc8e161, 0x2d455f3d, 0x9b4c6f9f, 0x2e267d36
+    .word   0x99d722db, 0x2f057b80, 0x9868c80a, 0x2fe26443, 0x97012e02, 0x30bd4161
+    .word   0x95a02568, 0x31961c77, 0x94458094, 0x326cfedb, 0x92f11384, 0x3341f1a7
+    .word   0x91a2b3c5, 0x3414fdb5, 0x905a3863, 0x34e62ba0, 0x8f1779da, 0x35b583ce
+    .word   0x8dda5202, 0x36830e69, 0x8ca29c04, 0x374ed367, 0x8b70344a, 0x3818da89
+    .word   0x8a42f870, 0x38e12b5d, 0x891ac73b, 0x39a7cd42, 0x87f78088, 0x3a6cc765
+    .word   0x86d90544, 0x3b3020c8, 0x85bf3761, 0x3bf1e041, 0x84a9f9c8, 0x3cb20c79
+    .word   0x83993052, 0x3d70abf2, 0x828cbfbf, 0x3e2dc504, 0x81848da9, 0x3ee95de2
+    .word   0x80808081, 0x3fa37c99
@@ -35,13 +35,15 @@ __agbabi_fiq_memcpy4:
     ldmiage r1!, {r3-r14}
     stmiage r0!, {r3-r14}
     bgt     .Lloop_48
+    @ r2 = 0 when finished, or < 48 bytes remaining
+    addlt   r2, r2, #48
 
-    @ Exit FIQ mode
+    @ Exit FIQ mode (restores flags)
     mrs     r3, spsr
     msr     cpsr, r3
     pop     {r4-r7}
 
-    adds    r2, r2, #48
+    cmp     r2, #0
     bxeq    lr
 
 .Lcopy_words:
@@ -81,6 +83,8 @@ __agbabi_fiq_memcpy4x4:
     ldmiage r1!, {r3-r14}
     stmiage r0!, {r3-r14}
     bgt     .Lloop_48_4x4
+    @ r2 = 0 when finished, or < 48 bytes remaining
+    addlt   r2, r2, #48
 
     @ Exit FIQ mode
     mrs     r3, spsr
@@ -0,0 +1,74 @@
+@===============================================================================
+@
+@ Support:
+@    __agbabi_fiq_memmove4, __agbabi_fiq_rmemcpy4
+@
+@ Copyright (C) 2021-2023 agbabi contributors
+@ For conditions of distribution and use, see copyright notice in LICENSE.md
+@
+@===============================================================================
+
+.syntax unified
+.include "macros.inc"
+
+    .arm
+    .align 2
+
+    .section .iwram.__agbabi_fiq_memmove4, "ax", %progbits
+    .global __agbabi_fiq_memmove4
+    .type __agbabi_fiq_memmove4, %function
+__agbabi_fiq_memmove4:
+    cmp     r0, r1
+    bgt     __agbabi_fiq_rmemcpy4
+    .extern __agbabi_fiq_memcpy4
+    b       __agbabi_fiq_memcpy4
+
+    .global __agbabi_fiq_rmemcpy4
+    .type __agbabi_fiq_rmemcpy4, %function
+__agbabi_fiq_rmemcpy4:
+    @ Copy byte & half tail
+    joaobapt_test_into r3, r2
+    @ Copy byte
+    submi   r2, r2, #1
+    ldrbmi  r3, [r1, r2]
+    strbmi  r3, [r0, r2]
+    @ Copy half
+    subcs   r2, r2, #2
+    ldrhcs  r3, [r1, r2]
+    strhcs  r3, [r0, r2]
+    @ r2 is now word aligned
+
+    add     r0, r0, r2
+    add     r1, r1, r2
+
+    cmp     r2, #48
+    blt     .Lcopy_words
+
+    push    {r4-r7}
+    mrs     r3, cpsr
+
+    @ Enter FIQ mode
+    bic     r12, r3, #0x1f
+    orr     r12, #0x11
+    msr     cpsr, r12
+    msr     spsr, r3
+
+.Lloop_48:
+    subs    r2, r2, #48
+    ldmdbge r1!, {r3-r14}
+    stmdbge r0!, {r3-r14}
+    bgt     .Lloop_48
+    @ r2 = 0 when finished, or < 48 bytes remaining
+    addlt   r2, r2, #48
+
+    @ Exit FIQ mode (restores flags)
+    mrs     r3, spsr
+    msr     cpsr, r3
+    pop     {r4-r7}
+
+.Lcopy_words:
+    subs    r2, r2, #4
+    ldrge   r3, [r1, #-4]!
+    strge   r3, [r0, #-4]!
+    bgt     .Lcopy_words
+    bx      lr
@@ -0,0 +1,75 @@
+@===============================================================================
+@
+@ Support:
+@    __agbabi_fiq_memset4, __agbabi_fiq_wordset4, __agbabi_fiq_lwordset4
+@
+@ Copyright (C) 2021-2023 agbabi contributors
+@ For conditions of distribution and use, see copyright notice in LICENSE.md
+@
+@===============================================================================
+
+.syntax unified
+
+    .arm
+    .align 2
+
+    .section .iwram.__agbabi_fiq_memset4, "ax", %progbits
+    .global __agbabi_fiq_memset4
+    .type __agbabi_fiq_memset4, %function
+__agbabi_fiq_memset4:
+    lsl     r2, r2, #24
+    orr     r2, r2, r2, lsr #8
+    orr     r2, r2, r2, lsr #16
+
+    .global __agbabi_fiq_wordset4
+    .type __agbabi_fiq_wordset4, %function
+__agbabi_fiq_wordset4:
+    mov     r3, r2
+
+    .global __agbabi_fiq_lwordset4
+    .type __agbabi_fiq_lwordset4, %function
+__agbabi_fiq_lwordset4:
+    @ 192 words is roughly the threshold when FIQ setup is slower
+    cmp     r1, #768
+    .extern __agbabi_lwordset4
+    blt     __agbabi_lwordset4
+
+    push    {r4-r7}
+    mrs     r4, cpsr
+
+    @ Enter FIQ mode
+    bic     r12, r4, #0x1f
+    orr     r12, #0x11
+    msr     cpsr, r12
+    msr     spsr, r4
+
+    @ r3-r14 = lo, hi, lo, hi...
+    mov     r4, r3
+    mov     r3, r2
+    mov     r5, r3
+    mov     r6, r4
+    mov     r7, r3
+    mov     r8, r4
+    mov     r9, r3
+    mov     r10, r4
+    mov     r11, r3
+    mov     r12, r4
+    mov     r13, r3
+    mov     r14, r4
+
+.Lset_48:
+    subs    r1, r1, #48
+    stmiage r0!, {r3-r14}
+    bgt     .Lset_48
+    @ r1 = 0 when finished, or < 48 bytes remaining
+    addlt   r1, r1, #48
+
+    @ Exit FIQ mode (restores flags)
+    mrs     r3, spsr
+    msr     cpsr, r3
+    mov     r3, r4
+    pop     {r4-r7}
+
+    cmp     r1, #0
+    bxeq    lr
+    b       __agbabi_lwordset4
@@ -0,0 +1,608 @@
+@===============================================================================
+@
+@ ABI:
+@    __aeabi_fadd, __aeabi_fsub, __aeabi_frsub, __aeabi_fmul, __aeabi_fdiv,
+@    __aeabi_i2f, __aeabi_ui2f, __aeabi_l2f, __aeabi_ul2f, __aeabi_f2iz,
+@    __aeabi_f2uiz,
+@    __aeabi_fcmpeq, __aeabi_fcmplt, __aeabi_fcmple, __aeabi_fcmpge,
+@    __aeabi_fcmpgt, __aeabi_fcmpun
+@
+@ IEEE 754 single precision, rounding to nearest even
+@ Assembling with AGBABI_FAST_MATH defined treats denormal inputs as zero,
+@ flushes denormal results to zero, and skips infinity and NaN inputs
+@
+@ Copyright (C) 2021-2023 agbabi contributors
+@ For conditions of distribution and use, see copyright notice in LICENSE.md
+@
+@===============================================================================
+
+.syntax unified
+.include "macros.inc"
+
+@ Converts r0 and r1 to integers that order like the floats, with +0 and -0 equal
+@ Branches to \unordered if either is NaN, then compares r0 with r1
+.macro fcmp_ordered unordered
+    lsl     r2, r0, #1
+    lsl     r3, r1, #1
+.ifndef AGBABI_FAST_MATH
+    cmp     r2, #0xff000000
+    cmpls   r3, #0xff000000
+    bhi     \unordered
+.endif
+    orrs    r12, r2, r3
+    moveq   r0, r1
+
+    @ Negative floats order backwards, flip all but the sign
+    asr     r2, r0, #31
+    eor     r0, r0, r2, lsr #1
+    asr     r3, r1, #31
+    eor     r1, r1, r3, lsr #1
+    cmp     r0, r1
+.endm
+
+    .arm
+    .align 2
+
+    .section .iwram.__aeabi_fadd, "ax", %progbits
+    .global __aeabi_frsub
+    .type __aeabi_frsub, %function
+__aeabi_frsub:
+    eor     r0, r0, #0x80000000
+    b       __aeabi_fadd
+
+    .global __aeabi_fsub
+    .type __aeabi_fsub, %function
+__aeabi_fsub:
+    eor     r1, r1, #0x80000000
+    @ Fallthrough
+
+    .global __aeabi_fadd
+    .type __aeabi_fadd, %function
+__aeabi_fadd:
+    @ Order the operands so that |a| >= |b|
+    lsl     r2, r0, #1
+    lsl     r3, r1, #1
+    cmp     r2, r3
+    movlo   r12, r0
+    movlo   r0, r1
+    movlo   r1, r12
+    movlo   r12, r2
+    movlo   r2, r3
+    movlo   r3, r12
+
+.ifndef AGBABI_FAST_MATH
+    cmp     r2, #0xff000000
+    bhs     .Lfadd_inf_nan
+.endif
+
+    lsrs    r3, r3, #24
+    beq     .Lfadd_small
+    lsr     r2, r2, #24
+
+    @ b is below half an ulp of a
+    sub     r3, r2, r3
+    cmp     r3, #25
+    bxhi    lr
+
+    @ r2 = sign of a | exponent of a, N = signs differ
+    and     r12, r0, #0x80000000
+    orr     r2, r2, r12
+    teq     r0, r1
+
+    @ Mantissas with their leading bit at bit 31
+    lsl     r0, r0, #8
+    orr     r0, r0, #0x80000000
+    lsl     r1, r1, #8
+    orr     r1, r1, #0x80000000
+
+.Lfadd_aligned:
+    @ r12 = bits of b shifted out by the exponent difference r3
+    rsb     r12, r3, #32
+    bmi     .Lfadd_subtract
+    lsl     r12, r1, r12
+
+    adds    r0, r0, r1, lsr r3
+    bcc     .Lfadd_sign
+
+    @ Carry out, shift it back in and increase the exponent
+    orr     r12, r12, r0, lsl #31
+    rrx     r0, r0
+    add     r2, r2, #1
+
+.Lfadd_sign:
+    and     r3, r2, #0x80000000
+    bic     r2, r2, #0x80000000
+    sub     r2, r2, #1
+
+.Lfadd_round:
+    fpack
+
+.Lfadd_subtract:
+    @ r0:r12 = a - b exactly, r12 is only non-zero if b was shifted right 9 or more
+    lsl     r12, r1, r12
+    rsbs    r12, r12, #0
+    sbc     r0, r0, r1, lsr r3
+    and     r3, r2, #0x80000000
+    bic     r2, r2, #0x80000000
+    sub     r2, r2, #1
+
+    @ Equal magnitudes give +0
+    cmp     r0, #0
+    bmi     .Lfadd_round
+    bxeq    lr
+
+    @ Only the first shift can take a bit from r12, as r0 >= 2^30 when r12 is non-zero
+    adds    r12, r12, r12
+    adc     r0, r0, r0
+    sub     r2, r2, #1
+    fnorm   r0, r2
+    b       .Lfadd_round
+
+.Lfadd_small:
+    @ b is zero, or a denormal
+.ifndef AGBABI_FAST_MATH
+    lsls    r12, r1, #1
+    bne     .Lfadd_denormal
+.endif
+    @ Return a, unless both are zero and only one is negative
+    lsls    r12, r0, #1
+    andeq   r0, r0, r1
+    bx      lr
+
+.ifndef AGBABI_FAST_MATH
+.Lfadd_denormal:
+    lsrs    r2, r2, #24
+    beq     .Lfadd_denormals
+
+    @ b has an exponent of 1 and no leading bit
+    sub     r3, r2, #1
+    cmp     r3, #25
+    bxhi    lr
+    and     r12, r0, #0x80000000
+    orr     r2, r2, r12
+    teq     r0, r1
+    lsl     r0, r0, #8
+    orr     r0, r0, #0x80000000
+    lsl     r1, r1, #8
+    b       .Lfadd_aligned
+
+.Lfadd_denormals:
+    @ Both denormal, the sum is exact, and a carry makes a normal
+    teq     r0, r1
+    bic     r1, r1, #0x80000000
+    addpl   r0, r0, r1
+    submi   r0, r0, r1
+    lsls    r12, r0, #1
+    moveq   r0, #0
+    bx      lr
+
+.Lfadd_inf_nan:
+    @ a is the larger, so NaN if either is NaN
+    orrhi   r0, r0, #0x00400000
+    bxhi    lr
+
+    @ Infinity, minus infinity is NaN
+    cmp     r3, #0xff000000
+    bxne    lr
+    teq     r0, r1
+    bxpl    lr
+    mov     r0, #0x7f000000
+    orr     r0, r0, #0x00c00000
+    bx      lr
+.endif
+
+    .section .iwram.__aeabi_fmul, "ax", %progbits
+    .global __aeabi_fmul
+    .type __aeabi_fmul, %function
+__aeabi_fmul:
+    @ r2, r3 = exponents
+    mov     r12, #0xff
+    ands    r2, r12, r0, lsr #23
+    andsne  r3, r12, r1, lsr #23
+.ifndef AGBABI_FAST_MATH
+    teqne   r2, #0xff
+    teqne   r3, #0xff
+.endif
+    beq     .Lfmul_special
+
+    add     r2, r2, r3
+    eor     r3, r0, r1
+    and     r3, r3, #0x80000000
+
+    @ Mantissas with their leading bit at bit 31
+    lsl     r0, r0, #8
+    orr     r0, r0, #0x80000000
+    lsl     r1, r1, #8
+    orr     r1, r1, #0x80000000
+
+.Lfmul_mantissa:
+    @ r0:r12 = product, in [2^62, 2^64)
+    umull   r12, r0, r1, r0
+    sub     r2, r2, #127
+
+    @ Normalize a product below 2^63
+    cmp     r0, #0
+    lslpl   r0, r0, #1
+    orrpl   r0, r0, r12, lsr #31
+    lslpl   r12, r12, #1
+    subpl   r2, r2, #1
+
+    fpack
+
+.Lfmul_special:
+    eor     r12, r0, r1
+    and     r12, r12, #0x80000000
+.ifdef AGBABI_FAST_MATH
+    @ Zero or denormal
+    mov     r0, r12
+    bx      lr
+.else
+    lsl     r2, r0, #1
+    lsl     r3, r1, #1
+
+    @ NaN
+    cmp     r2, #0xff000000
+    orrhi   r0, r0, #0x00400000
+    bxhi    lr
+    cmp     r3, #0xff000000
+    orrhi   r0, r1, #0x00400000
+    bxhi    lr
+
+    @ Infinity, times zero is NaN
+    cmpne   r2, #0xff000000
+    bne     .Lfmul_finite
+    cmp     r2, #0
+    cmpne   r3, #0
+    moveq   r0, #0x7f000000
+    orreq   r0, r0, #0x00c00000
+    orrne   r0, r12, #0x7f000000
+    orrne   r0, r0, #0x00800000
+    bx      lr
+
+.Lfmul_finite:
+    @ Zero
+    cmp     r2, #0
+    cmpne   r3, #0
+    moveq   r0, r12
+    bxeq    lr
+
+    @ Denormals have an exponent of 1 and no leading bit
+    lsrs    r2, r2, #24
+    lsl     r0, r0, #8
+    orrne   r0, r0, #0x80000000
+    moveq   r2, #1
+    fnorm   r0, r2
+
+    lsrs    r3, r3, #24
+    lsl     r1, r1, #8
+    orrne   r1, r1, #0x80000000
+    moveq   r3, #1
+    fnorm   r1, r3
+
+    add     r2, r2, r3
+    mov     r3, r12
+    b       .Lfmul_mantissa
+.endif
+
+    .section .iwram.__aeabi_fdiv, "ax", %progbits
+    .global __aeabi_fdiv
+    .type __aeabi_fdiv, %function
+__aeabi_fdiv:
+    @ r2, r3 = exponents
+    mov     r12, #0xff
+    ands    r2, r12, r0, lsr #23
+    andsne  r3, r12, r1, lsr #23
+.ifndef AGBABI_FAST_MATH
+    teqne   r2, #0xff
+    teqne   r3, #0xff
+.endif
+    beq     .Lfdiv_special
+
+    sub     r2, r2, r3
+    eor     r3, r0, r1
+    and     r3, r3, #0x80000000
+
+    @ Mantissas with their leading bit at bit 23
+    bic     r0, r0, #0xff000000
+    orr     r0, r0, #0x00800000
+    bic     r1, r1, #0xff000000
+    orr     r1, r1, #0x00800000
+
+.Lfdiv_mantissa:
+    @ Make the numerator at least the denominator, so the quotient is in [1, 2)
+    cmp     r0, r1
+    lsllo   r0, r0, #1
+    sublo   r2, r2, #1
+    add     r2, r2, #126
+
+    @ The first quotient bit is 1, then 23 mantissa bits and a guard bit
+    sub     r0, r0, r1
+    rsb     r1, r1, #0
+    mov     r12, #1
+    .rept 24
+    adds    r0, r1, r0, lsl #1
+    subcc   r0, r0, r1
+    adc     r12, r12, r12
+    .endr
+
+    @ The remainder is the sticky bits
+    mov     r1, r0
+    lsl     r0, r12, #7
+    mov     r12, r1
+
+    fpack
+
+.Lfdiv_special:
+    eor     r12, r0, r1
+    and     r12, r12, #0x80000000
+.ifdef AGBABI_FAST_MATH
+    @ Zero divided is zero, division by zero is infinity
+    cmp     r2, #0
+    moveq   r0, r12
+    orrne   r0, r12, #0x7f000000
+    orrne   r0, r0, #0x00800000
+    bx      lr
+.else
+    lsl     r2, r0, #1
+    lsl     r3, r1, #1
+
+    @ NaN
+    cmp     r2, #0xff000000
+    orrhi   r0, r0, #0x00400000
+    bxhi    lr
+    cmp     r3, #0xff000000
+    orrhi   r0, r1, #0x00400000
+    bxhi    lr
+
+    @ Infinity divided by infinity is NaN, otherwise infinity
+    cmp     r2, #0xff000000
+    bne     .Lfdiv_finite
+    cmp     r3, #0xff000000
+    moveq   r0, #0x7f000000
+    orreq   r0, r0, #0x00c00000
+    orrne   r0, r12, #0x7f000000
+    orrne   r0, r0, #0x00800000
+    bx      lr
+
+.Lfdiv_finite:
+    @ Divided by infinity is zero
+    cmp     r3, #0xff000000
+    moveq   r0, r12
+    bxeq    lr
+
+    @ Zero divided by zero is NaN, otherwise division by zero is infinity
+    cmp     r3, #0
+    bne     .Lfdiv_nonzero
+    cmp     r2, #0
+    moveq   r0, #0x7f000000
+    orreq   r0, r0, #0x00c00000
+    orrne   r0, r12, #0x7f000000
+    orrne   r0, r0, #0x00800000
+    bx      lr
+
+.Lfdiv_nonzero:
+    @ Zero divided is zero
+    cmp     r2, #0
+    moveq   r0, r12
+    bxeq    lr
+
+    @ Denormals have an exponent of 1 and no leading bit
+    lsrs    r2, r2, #24
+    lsl     r0, r0, #8
+    orrne   r0, r0, #0x80000000
+    moveq   r2, #1
+    fnorm   r0, r2
+    lsr     r0, r0, #8
+
+    lsrs    r3, r3, #24
+    lsl     r1, r1, #8
+    orrne   r1, r1, #0x80000000
+    moveq   r3, #1
+    fnorm   r1, r3
+    lsr     r1, r1, #8
+
+    sub     r2, r2, r3
+    mov     r3, r12
+    b       .Lfdiv_mantissa
+.endif
+
+    .section .iwram.__aeabi_i2f, "ax", %progbits
+    .global __aeabi_i2f
+    .type __aeabi_i2f, %function
+__aeabi_i2f:
+    ands    r3, r0, #0x80000000
+    rsbne   r0, r0, #0
+    b       .Li2f
+
+    .global __aeabi_ui2f
+    .type __aeabi_ui2f, %function
+__aeabi_ui2f:
+    mov     r3, #0
+
+.Li2f:
+    cmp     r0, #0
+    bxeq    lr
+
+    @ Biased exponent - 1 with the leading bit at bit 31
+    mov     r2, #157
+    fnorm   r0, r2
+    mov     r12, #0
+
+    fpack
+
+    @ libgcc defines these alongside __aeabi_fadd, so they are needed to replace it
+    .global __aeabi_l2f
+    .type __aeabi_l2f, %function
+__aeabi_l2f:
+    ands    r3, r1, #0x80000000
+    beq     .Ll2f
+    rsbs    r0, r0, #0
+    rsc     r1, r1, #0
+    b       .Ll2f
+
+    .global __aeabi_ul2f
+    .type __aeabi_ul2f, %function
+__aeabi_ul2f:
+    mov     r3, #0
+
+.Ll2f:
+    cmp     r1, #0
+    beq     .Li2f
+
+    @ Biased exponent - 1 with the leading bit at bit 63
+    mov     r2, #189
+    fnorm   r1, r2
+
+    @ Shift the high bits of the low word in, r12 = 32 - shift, the rest are sticky
+    sub     r12, r2, #157
+    orr     r1, r1, r0, lsr r12
+    rsb     r12, r12, #32
+    lsl     r12, r0, r12
+    mov     r0, r1
+
+    fpack
+
+    .section .iwram.__aeabi_f2iz, "ax", %progbits
+    .global __aeabi_f2iz
+    .type __aeabi_f2iz, %function
+__aeabi_f2iz:
+    @ Below 1 truncates to 0
+    lsl     r2, r0, #1
+    cmp     r2, #0x7f000000
+    movlo   r0, #0
+    bxlo    lr
+
+    @ r3 = right shift of the mantissa, 2^31 and above saturate
+    mov     r3, #158
+    subs    r3, r3, r2, lsr #24
+    ble     .Lf2iz_saturate
+
+    lsl     r1, r0, #8
+    orr     r1, r1, #0x80000000
+    lsr     r1, r1, r3
+    teq     r0, #0
+    rsbmi   r0, r1, #0
+    movpl   r0, r1
+    bx      lr
+
+.Lf2iz_saturate:
+.ifndef AGBABI_FAST_MATH
+    @ NaN converts to 0
+    cmp     r2, #0xff000000
+    movhi   r0, #0
+    bxhi    lr
+.endif
+    mvn     r1, #0x80000000
+    add     r0, r1, r0, lsr #31
+    bx      lr
+
+    .section .iwram.__aeabi_f2uiz, "ax", %progbits
+    .global __aeabi_f2uiz
+    .type __aeabi_f2uiz, %function
+__aeabi_f2uiz:
+    @ Negative or below 1 truncates to 0
+    movs    r2, r0, lsl #1
+    movcs   r0, #0
+    bxcs    lr
+    cmp     r2, #0x7f000000
+    movlo   r0, #0
+    bxlo    lr
+
+    @ r3 = right shift of the mantissa, 2^32 and above saturate
+    mov     r3, #158
+    subs    r3, r3, r2, lsr #24
+    bmi     .Lf2uiz_saturate
+
+    lsl     r1, r0, #8
+    orr     r1, r1, #0x80000000
+    lsr     r0, r1, r3
+    bx      lr
+
+.Lf2uiz_saturate:
+.ifndef AGBABI_FAST_MATH
+    @ NaN converts to 0
+    cmp     r2, #0xff000000
+    movhi   r0, #0
+    bxhi    lr
+.endif
+    mvn     r0, #0
+    bx      lr
+
+    .section .iwram.__aeabi_fcmpeq, "ax", %progbits
+    .global __aeabi_fcmpeq
+    .type __aeabi_fcmpeq, %function
+__aeabi_fcmpeq:
+    lsl     r2, r0, #1
+    lsl     r3, r1, #1
+.ifndef AGBABI_FAST_MATH
+    cmp     r2, #0xff000000
+    cmpls   r3, #0xff000000
+    movhi   r0, #0
+    bxhi    lr
+.endif
+    @ Equal bits, or +0 and -0
+    orrs    r12, r2, r3
+    cmpne   r0, r1
+    moveq   r0, #1
+    movne   r0, #0
+    bx      lr
+
+    .section .iwram.__aeabi_fcmplt, "ax", %progbits
+    .global __aeabi_fcmplt
+    .type __aeabi_fcmplt, %function
+__aeabi_fcmplt:
+    fcmp_ordered .Lfcmplt_unordered
+    movlt   r0, #1
+    movge   r0, #0
+    bx      lr
+.Lfcmplt_unordered:
+    mov     r0, #0
+    bx      lr
+
+    .section .iwram.__aeabi_fcmple, "ax", %progbits
+    .global __aeabi_fcmple
+    .type __aeabi_fcmple, %function
+__aeabi_fcmple:
+    fcmp_ordered .Lfcmple_unordered
+    movle   r0, #1
+    movgt   r0, #0
+    bx      lr
+.Lfcmple_unordered:
+    mov     r0, #0
+    bx      lr
+
+    .section .iwram.__aeabi_fcmpge, "ax", %progbits
+    .global __aeabi_fcmpge
+    .type __aeabi_fcmpge, %function
+__aeabi_fcmpge:
+    fcmp_ordered .Lfcmpge_unordered
+    movge   r0, #1
+    movlt   r0, #0
+    bx      lr
+.Lfcmpge_unordered:
+    mov     r0, #0
+    bx      lr
+
+    .section .iwram.__aeabi_fcmpgt, "ax", %progbits
+    .global __aeabi_fcmpgt
+    .type __aeabi_fcmpgt, %function
+__aeabi_fcmpgt:
+    fcmp_ordered .Lfcmpgt_unordered
+    movgt   r0, #1
+    movle   r0, #0
+    bx      lr
+.Lfcmpgt_unordered:
+    mov     r0, #0
+    bx      lr
+
+    .section .iwram.__aeabi_fcmpun, "ax", %progbits
+    .global __aeabi_fcmpun
+    .type __aeabi_fcmpun, %function
+__aeabi_fcmpun:
+    lsl     r2, r0, #1
+    lsl     r3, r1, #1
+    cmp     r2, #0xff000000
+    cmpls   r3, #0xff000000
+    movhi   r0, #1
+    movls   r0, #0
+    bx      lr
@@ -0,0 +1,174 @@
+@===============================================================================
+@
+@ Support:
+@    __agbabi_fxdiv16, __agbabi_fxdiv12, __agbabi_fxdiv8,
+@    __agbabi_fxdiv16_approx, __agbabi_fxdiv12_approx, __agbabi_fxdiv8_approx
+@
+@ Copyright (C) 2021-2023 agbabi contributors
+@ For conditions of distribution and use, see copyright notice in LICENSE.md
+@
+@===============================================================================
+
+.syntax unified
+
+    .arm
+    .align 2
+
+    @ r0: the numerator / r1: the denominator
+    @ after it, r0 has (numerator << Q) / denominator, saturated to the range of int
+    .section .iwram.__agbabi_fxdiv, "ax", %progbits
+    .global __agbabi_fxdiv16
+    .type __agbabi_fxdiv16, %function
+__agbabi_fxdiv16:
+    mov     r3, #16
+    b       .Lfxdiv
+
+    .global __agbabi_fxdiv12
+    .type __agbabi_fxdiv12, %function
+__agbabi_fxdiv12:
+    mov     r3, #12
+    b       .Lfxdiv
+
+    .global __agbabi_fxdiv8
+    .type __agbabi_fxdiv8, %function
+__agbabi_fxdiv8:
+    mov     r3, #8
+    @ Fallthrough
+
+.Lfxdiv:
+    @ Check for division by zero
+    cmp     r1, #0
+    .extern __aeabi_idiv0
+    beq     __aeabi_idiv0
+
+    @ Move the lr to r12, bit 31 is whether the quotient is negative
+    eor     r12, r0, r1
+    and     r12, r12, #1 << 31
+    orr     r12, r12, lr
+
+    @ Make the numbers positive, r2 = denominator
+    cmp     r0, #0
+    rsblt   r0, r0, #0
+    movs    r2, r1
+    rsbmi   r2, r2, #0
+
+    @ r0:r1 = numerator << Q
+    rsb     r1, r3, #32
+    lsr     r1, r0, r1
+    lsl     r0, r0, r3
+
+    @ The quotient needs more than 32 bits when the high word is not below the denominator
+    cmp     r1, r2
+    mvnhs   r0, #0
+    .extern __agbabi_unsafe_uluidivmod
+    bllo    __agbabi_unsafe_uluidivmod
+
+    @ Clamp to INT_MAX, or to -INT_MIN for a negative quotient
+    mvn     r2, #1 << 31
+    add     r2, r2, r12, lsr #31
+    cmp     r0, r2
+    movhi   r0, r2
+
+    @ Apply the sign, erase it from the return address, and return
+    tst     r12, #1 << 31
+    rsbne   r0, r0, #0
+    bic     r12, r12, #1 << 31
+    bx      r12
+
+    @ r0: the numerator / r1: the denominator
+    @ after it, r0 has (numerator << Q) / denominator rounded towards zero, by up to 2 units in the last place
+    .section .iwram.__agbabi_fxdiv_approx, "ax", %progbits
+    .global __agbabi_fxdiv16_approx
+    .type __agbabi_fxdiv16_approx, %function
+__agbabi_fxdiv16_approx:
+    mov     r3, #63 - 16
+    b       .Lfxdiv_approx
+
+    .global __agbabi_fxdiv12_approx
+    .type __agbabi_fxdiv12_approx, %function
+__agbabi_fxdiv12_approx:
+    mov     r3, #63 - 12
+    b       .Lfxdiv_approx
+
+    .global __agbabi_fxdiv8_approx
+    .type __agbabi_fxdiv8_approx, %function
+__agbabi_fxdiv8_approx:
+    mov     r3, #63 - 8
+    @ Fallthrough
+
+.Lfxdiv_approx:
+    @ Check for division by zero
+    cmp     r1, #0
+    beq     __aeabi_idiv0
+
+    @ Bit 31 of r12 is whether the quotient is negative
+    eor     r12, r0, r1
+
+    @ Make the numbers positive
+    cmp     r0, #0
+    rsblt   r0, r0, #0
+    cmp     r1, #0
+    rsblt   r1, r1, #0
+
+    push    {r4, r5}
+
+    @ Normalize the denominator to d = r1 / 2^32 in [0.5, 1)
+    @ r3 = 63 - Q - the number of leading zeros
+    cmp     r1, #1 << 16
+    lsllo   r1, r1, #16
+    sublo   r3, r3, #16
+    cmp     r1, #1 << 24
+    lsllo   r1, r1, #8
+    sublo   r3, r3, #8
+    cmp     r1, #1 << 28
+    lsllo   r1, r1, #4
+    sublo   r3, r3, #4
+    cmp     r1, #1 << 30
+    lsllo   r1, r1, #2
+    sublo   r3, r3, #2
+    cmp     r1, #1 << 31
+    lsllo   r1, r1, #1
+    sublo   r3, r3, #1
+
+    @ Linear estimate of the reciprocal, x = 48/17 - 32/17 * d
+    @ x is Q31, which wraps 48/17 modulo 2^32
+    ldr     r2, =0xf0f0f0f0     @ 16/17 as Q32
+    umull   r4, r5, r1, r2
+    ldr     r2, =0x69696969     @ 48/17 as Q31
+    sub     r2, r2, r5
+
+    @ Newton-Raphson, x = x * (2 - d * x), each iteration doubles the precision
+    @ 2 - d * x is rounded down so x never exceeds 1 / d
+    .rept 3
+    umull   r4, r5, r1, r2
+    mvn     r5, r5
+    umull   r4, r5, r2, r5
+    lsl     r2, r5, #1
+    orr     r2, r2, r4, lsr #31
+    .endr
+
+    @ r0 = (numerator * x) >> r3, r3 is between 16 and 55
+    @ Register shifts of 32 or more (including negative amounts) produce 0
+    umull   r4, r5, r0, r2
+    lsr     r0, r4, r3
+    rsb     r1, r3, #32
+    orr     r0, r0, r5, lsl r1
+    sub     r1, r3, #32
+    orr     r0, r0, r5, lsr r1
+
+    @ The quotient needs more than 32 bits when anything is left of the high word
+    lsrs    r5, r5, r3
+    mvnne   r0, #0
+
+    pop     {r4, r5}
+
+    @ Clamp to INT_MAX, or to -INT_MIN for a negative quotient
+    mvn     r2, #1 << 31
+    add     r2, r2, r12, lsr #31
+    cmp     r0, r2
+    movhi   r0, r2
+
+    @ Apply the sign
+    cmp     r12, #0
+    rsblt   r0, r0, #0
+    bx      lr
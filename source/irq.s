@@ -72,17 +72,36 @@ __agbabi_irq_user:
     orr     r2, r2, #0x1f
     msr     cpsr, r2
 
+    push    {r0-r1, r4-r11, lr}
+
+    @ Call __agbabi_dma_queue_irq if it is linked and a DMA IRQ was raised
+    @ r4 = DMA flags of drained channels, which stay disabled in REG_IE
+    mov     r4, #0
+    .weak __agbabi_dma_queue_irq
+    ldr     r2, =__agbabi_dma_queue_irq
+    cmp     r2, #0
+    tstne   r0, #0xf00
+    beq     .Lirq_user_fn
+    mov     lr, pc
+    bx      r2
+    mov     r4, r0
+
+.Lirq_user_fn:
+    ldr     r0, [sp]
+
     @ Load user IRQ proc
     .comm __agbabi_irq_user_fn, 4, 4
     ldr     r2, =__agbabi_irq_user_fn
     ldr     r2, [r2]
 
-    push    {r0-r1, r4-r11, lr}
-
     @ Call __agbabi_irq_user_fn
     mov     lr, pc
     bx      r2
 
+    ldr     r0, [sp]
+    bic     r0, r0, r4
+    str     r0, [sp]
+
     pop     {r0-r1, r4-r11, lr}
 
     @ Disable REG_IME again
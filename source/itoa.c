@@ -0,0 +1,171 @@
+/*
+===============================================================================
+
+ Support:
+    __agbabi_utoa10, __agbabi_itoa10, __agbabi_ulltoa10, __agbabi_utoa16,
+    __agbabi_utobcd
+
+ Copyright (C) 2021-2023 agbabi contributors
+ For conditions of distribution and use, see copyright notice in LICENSE.md
+
+===============================================================================
+*/
+
+#include <agbabi.h>
+
+typedef unsigned int u32;
+typedef unsigned long long u64;
+
+/* Prepared the same as __agbabi_uluidiv_prepare(&div, 100000000) */
+static const __agbabi_uluidiv_t hundred_million = {0xabcc77118461cefdull, 26};
+
+static const char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/* Exact for all 32-bit x */
+static inline __attribute__((always_inline, const)) u32 div100(u32 x) {
+    return (u32) (((u64) x * 0x51eb851fu) >> 37);
+}
+
+/* Exact for all 32-bit x */
+static inline __attribute__((always_inline, const)) u32 div10000(u32 x) {
+    return (u32) (((u64) x * 0xd1b71759u) >> 45);
+}
+
+/* Exact for x < 43699 */
+static inline __attribute__((always_inline, const)) u32 div100_small(u32 x) {
+    return (x * 5243u) >> 19;
+}
+
+static inline __attribute__((always_inline, const)) u32 count_digits(u32 x) {
+    u32 n = 1;
+    n += x >= 10u;
+    n += x >= 100u;
+    n += x >= 1000u;
+    n += x >= 10000u;
+    n += x >= 100000u;
+    n += x >= 1000000u;
+    n += x >= 10000000u;
+    n += x >= 100000000u;
+    n += x >= 1000000000u;
+    return n;
+}
+
+static inline __attribute__((always_inline)) void write_pair(char* p, u32 x) {
+    p[0] = digit_pairs[x * 2];
+    p[1] = digit_pairs[x * 2 + 1];
+}
+
+/* Packs x < 100 as 2 BCD digits, 10 * tens + ones becomes 16 * tens + ones */
+static inline __attribute__((always_inline, const)) u32 bcd_pair(u32 x) {
+    return x + ((x * 205u) >> 11) * 6;
+}
+
+/* Packs x < 10000 as 4 BCD digits */
+static inline __attribute__((always_inline, const)) u32 bcd_4_digits(u32 x) {
+    const u32 high = div100_small(x);
+
+    return (bcd_pair(high) << 8) | bcd_pair(x - high * 100);
+}
+
+/* Writes x < 10000 as 4 digits */
+static inline __attribute__((always_inline)) void write_4_digits(char* p, u32 x) {
+    const u32 high = div100_small(x);
+
+    write_pair(p, high);
+    write_pair(p + 2, x - high * 100);
+}
+
+/* Writes x < 100000000 as 8 digits */
+static inline __attribute__((always_inline)) void write_8_digits(char* p, u32 x) {
+    const u32 high = div10000(x);
+
+    write_4_digits(p, high);
+    write_4_digits(p + 4, x - high * 10000);
+}
+
+char* __attribute__((section(".iwram.__agbabi_utoa10"))) __agbabi_utoa10(unsigned int value, char* buffer) {
+    char* const end = buffer + count_digits(value);
+    char* p = end;
+
+    *p = '\0';
+    while (value >= 100) {
+        const u32 high = div100(value);
+
+        p -= 2;
+        write_pair(p, value - high * 100);
+        value = high;
+    }
+
+    if (value >= 10) {
+        write_pair(p - 2, value);
+    } else {
+        p[-1] = (char) ('0' + value);
+    }
+    return end;
+}
+
+char* __attribute__((section(".iwram.__agbabi_itoa10"))) __agbabi_itoa10(int value, char* buffer) {
+    if (value < 0) {
+        *buffer++ = '-';
+        return __agbabi_utoa10(0u - (u32) value, buffer);
+    }
+    return __agbabi_utoa10((u32) value, buffer);
+}
+
+char* __attribute__((section(".iwram.__agbabi_ulltoa10"))) __agbabi_ulltoa10(unsigned long long value, char* buffer) {
+    if ((value >> 32) == 0) {
+        return __agbabi_utoa10((u32) value, buffer);
+    }
+
+    /* Split into 8 digit groups by multiplying with the reciprocal of 10^8 */
+    const u64 high = __agbabi_uluidiv_prepared(value, &hundred_million);
+    const u32 low = (u32) value - (u32) high * 100000000u;
+
+    char* p;
+    if ((high >> 32) == 0) {
+        p = __agbabi_utoa10((u32) high, buffer);
+    } else {
+        const u32 top = (u32) __agbabi_uluidiv_prepared(high, &hundred_million);
+
+        p = __agbabi_utoa10(top, buffer);
+        write_8_digits(p, (u32) high - top * 100000000u);
+        p += 8;
+    }
+
+    write_8_digits(p, low);
+    p[8] = '\0';
+    return p + 8;
+}
+
+char* __attribute__((section(".iwram.__agbabi_utoa16"))) __agbabi_utoa16(unsigned int value, char* buffer) {
+    u32 n = 1;
+    for (u32 x = value >> 4; x; x >>= 4) {
+        ++n;
+    }
+
+    char* const end = buffer + n;
+    char* p = end;
+
+    *p = '\0';
+    do {
+        *--p = "0123456789abcdef"[value & 0xf];
+        value >>= 4;
+    } while (value);
+    return end;
+}
+
+unsigned int __attribute__((section(".iwram.__agbabi_utobcd"))) __agbabi_utobcd(unsigned int value) {
+    const u32 high = div10000(value);
+
+    return (bcd_4_digits(high) << 16) | bcd_4_digits(value - high * 10000);
+}
@@ -3,7 +3,9 @@
 @ ABI:
 @    __aeabi_ldivmod
 @ Support:
-@    __agbabi_ldiv
+@    __agbabi_ldiv, __agbabi_lidiv, __agbabi_lidivmod
+@
+@ Signed wrappers of __aeabi_uldivmod and __agbabi_uluidiv, with a 32-bit fast path
 @
 @ Taken with permission from github.com/JoaoBaptMG/gba-modern (2020-11-17)
 @ Modified for libagbabi
@@ -15,9 +17,23 @@
     .arm
     .align 2
 
-    @ r0:r1: the numerator / r2:r3: the denominator
+    @ r0:r1: the numerator / r2: the denominator
     @ after it, r0:r1 has the quotient and r2:r3 has the modulo
     .section .iwram.__aeabi_ldivmod, "ax", %progbits
+    .global __agbabi_lidivmod
+    .type __agbabi_lidivmod, %function
+__agbabi_lidivmod:
+    @ Fallthrough
+
+    .global __agbabi_lidiv
+    .type __agbabi_lidiv, %function
+__agbabi_lidiv:
+    @ Sign extend the denominator, a negative one has a zero high word once made positive
+    asr     r3, r2, #31
+    @ Fallthrough
+
+    @ r0:r1: the numerator / r2:r3: the denominator
+    @ after it, r0:r1 has the quotient and r2:r3 has the modulo
     .global __aeabi_ldivmod
     .type __aeabi_ldivmod, %function
 __aeabi_ldivmod:
@@ -32,6 +48,11 @@ __agbabi_ldiv:
     .extern __aeabi_ldiv0
     beq     __aeabi_ldiv0
 
+    @ Use the 32-bit division when both operands are sign extended 32-bit values
+    cmp     r1, r0, asr #31
+    cmpeq   r3, r2, asr #31
+    beq     .Ldivide32
+
     @ Move the lr to r12 and make the numbers positive
     mov     r12, lr
 
@@ -84,3 +105,42 @@ __agbabi_ldiv:
     @ Erase the sign bits from the return address, and return
     bic     r12, #0xF << 28
     bx      r12
+
+.Ldivide32:
+    @ INT_MIN / -1 is the only quotient that does not fit in 32 bits
+    cmn     r2, #1
+    beq     .LnegateNumerator
+
+    @ Same as __aeabi_idivmod, without its division by zero test
+    mov     r12, lr
+
+    cmp     r0, #0
+    rsblt   r0, r0, #0
+    orrlt   r12, #1 << 28
+
+    cmp     r2, #0
+    rsblt   r2, r2, #0
+    orrlt   r12, #1 << 31
+
+    mov     r1, r2
+    .extern __agbabi_unsafe_uidivmod
+    bl      __agbabi_unsafe_uidivmod
+
+    msr     cpsr_f, r12
+    rsblt   r0, r0, #0
+    rsbvs   r1, r1, #0
+
+    @ Sign extend the quotient and the modulo
+    mov     r2, r1
+    asr     r1, r0, #31
+    asr     r3, r2, #31
+
+    bic     r12, #0xF << 28
+    bx      r12
+
+.LnegateNumerator:
+    rsbs    r0, r0, #0
+    rsc     r1, r1, #0
+    mov     r2, #0
+    mov     r3, #0
+    bx      lr
@@ -1,7 +1,7 @@
 @===============================================================================
 @
 @ ABI:
-@    __aeabi_lmul, __aeabi_llsl, __aeabi_llsr, __aeabi_lasr
+@    __aeabi_lmul, __aeabi_llsl, __aeabi_llsr, __aeabi_lasr, __aeabi_lcmp, __aeabi_ulcmp
 @
 @ Copyright (C) 2021-2023 agbabi contributors
 @ For conditions of distribution and use, see copyright notice in LICENSE.md
@@ -58,3 +58,29 @@ __aeabi_lasr:
     orrmi   r0, r0, r1, lsl r12
     asr     r1, r1, r2
     bx      lr
+
+    .section .iwram.__aeabi_lcmp, "ax", %progbits
+    .global __aeabi_lcmp
+    .type __aeabi_lcmp, %function
+__aeabi_lcmp:
+    @ 64-bit subtraction, the difference is zero only when equal
+    subs    r12, r0, r2
+    sbcs    r3, r1, r3
+    mvnlt   r0, #0
+    bxlt    lr
+    orrs    r0, r12, r3
+    movne   r0, #1
+    bx      lr
+
+    .section .iwram.__aeabi_ulcmp, "ax", %progbits
+    .global __aeabi_ulcmp
+    .type __aeabi_ulcmp, %function
+__aeabi_ulcmp:
+    @ 64-bit subtraction, the difference is zero only when equal
+    subs    r12, r0, r2
+    sbcs    r3, r1, r3
+    mvnlo   r0, #0
+    bxlo    lr
+    orrs    r0, r12, r3
+    movne   r0, #1
+    bx      lr
@@ -5,7 +5,7 @@
 @ Standard:
 @    memcpy
 @ Support:
-@    __agbabi_memcpy2, __agbabi_memcpy1
+@    __agbabi_memcpy, __agbabi_memcpy2, __agbabi_memcpy1
 @
 @ Copyright (C) 2021-2023 agbabi contributors
 @ For conditions of distribution and use, see copyright notice in LICENSE.md
@@ -15,6 +15,56 @@
 .syntax unified
 .include "macros.inc"
 
+@ Forward copy from r1 (rounded down to a word, first word already in r12)
+@ into word aligned r0, recombining each pair of source words with a shift
+@ \shift = 8 * (original r1 & 3)
+@ Expects r4-r11 to have been pushed, pops them and finishes the byte tail
+.macro memcpy_shift shift
+.Lshift_\shift:
+    subs    r2, r2, #32
+    blt     2f
+1:
+    ldmia   r1!, {r4-r11}
+    lsr     r3, r12, #\shift
+    orr     r3, r3, r4, lsl #(32 - \shift)
+    lsr     r4, r4, #\shift
+    orr     r4, r4, r5, lsl #(32 - \shift)
+    lsr     r5, r5, #\shift
+    orr     r5, r5, r6, lsl #(32 - \shift)
+    lsr     r6, r6, #\shift
+    orr     r6, r6, r7, lsl #(32 - \shift)
+    lsr     r7, r7, #\shift
+    orr     r7, r7, r8, lsl #(32 - \shift)
+    lsr     r8, r8, #\shift
+    orr     r8, r8, r9, lsl #(32 - \shift)
+    lsr     r9, r9, #\shift
+    orr     r9, r9, r10, lsl #(32 - \shift)
+    lsr     r10, r10, #\shift
+    orr     r10, r10, r11, lsl #(32 - \shift)
+    mov     r12, r11
+    stmia   r0!, {r3-r10}
+    subs    r2, r2, #32
+    bge     1b
+2:
+    @ r2 = remaining - 4
+    adds    r2, r2, #28
+    blt     4f
+3:
+    ldr     r4, [r1], #4
+    lsr     r3, r12, #\shift
+    orr     r3, r3, r4, lsl #(32 - \shift)
+    mov     r12, r4
+    str     r3, [r0], #4
+    subs    r2, r2, #4
+    bge     3b
+4:
+    @ Rewind r1 to the first byte of r12 not yet copied
+    sub     r1, r1, #(4 - \shift / 8)
+    pop     {r4-r11}
+    add     r2, r2, #4
+    b       __agbabi_memcpy1
+.endm
+
     .arm
     .align 2
 
@@ -22,11 +72,20 @@
     .global __aeabi_memcpy
     .type __aeabi_memcpy, %function
 __aeabi_memcpy:
-    @ >6-bytes is roughly the threshold when byte-by-byte copy is slower
-    cmp     r2, #6
-    ble     __agbabi_memcpy1
+    @ Work RAM and ROM share one set of thresholds, so only video memory
+    @ dest (0x05-0x07) and SRAM (0x0E-0x0F) need dispatching
+    cmp     r0, #0x05000000
+    cmplo   r1, #0x0E000000
+    bhs     .Lcopy_region
+
+    .global __agbabi_memcpy
+    .type __agbabi_memcpy, %function
+__agbabi_memcpy:
+    @ <4-bytes is the threshold when byte-by-byte copy is faster in every region
+    cmp     r2, #4
+    blt     __agbabi_memcpy1
 
-    align_switch r0, r1, r3, __agbabi_memcpy1, .Lcopy_halves
+    align_switch r0, r1, r3, .Lcopy_shift_byte, .Lcopy_shift_half
 
     @ Check if r0 (or r1) needs word aligning
     rsbs    r3, r0, #4
@@ -119,6 +178,59 @@ __agbabi_memcpy1:
     bgt     __agbabi_memcpy1
     bx      lr
 
+.Lcopy_shift_half:
+    @ <32-bytes is roughly the threshold when half-by-half copy is faster
+    cmp     r2, #32
+    blt     .Lcopy_halves
+    b       .Lcopy_shift
+
+.Lcopy_shift_byte:
+    @ <12-bytes is roughly the threshold when byte-by-byte copy is faster
+    cmp     r2, #12
+    blt     __agbabi_memcpy1
+
+.Lcopy_shift:
+    @ No byte stores happen when r0 is word aligned and r2 is a multiple of 4
+    @ __agbabi_vram_memcpy relies on this
+    @ Copy byte head to word align r0
+    rsb     r3, r0, #4
+    joaobapt_test r3
+    ldrbmi  r3, [r1], #1
+    strbmi  r3, [r0], #1
+    submi   r2, r2, #1
+    ldrbcs  r3, [r1], #1
+    strbcs  r3, [r0], #1
+    ldrbcs  r3, [r1], #1
+    strbcs  r3, [r0], #1
+    subcs   r2, r2, #2
+    @ r0 is now word aligned, r1 is 1, 2, or 3 bytes past a word
+
+    @ Round r1 down and keep the partial first word in r12
+    and     r3, r1, #3
+    bic     r1, r1, #3
+    push    {r4-r11}
+    ldr     r12, [r1], #4
+
+    cmp     r3, #2
+    beq     .Lshift_16
+    bhi     .Lshift_24
+    @ Fallthrough
+
+    memcpy_shift 8
+    memcpy_shift 16
+    memcpy_shift 24
+
+.Lcopy_region:
+    @ SRAM has an 8-bit bus
+    cmp     r0, #0x0E000000
+    cmplo   r1, #0x0E000000
+    bhs     __agbabi_memcpy1
+    @ ROM dest is not writable, so only video memory dest remains
+    cmp     r0, #0x08000000
+    bhs     __agbabi_memcpy
+    .extern __agbabi_vram_memcpy
+    b       __agbabi_vram_memcpy
+
     .section .iwram.memcpy, "ax", %progbits
     .global memcpy
     .type memcpy, %function
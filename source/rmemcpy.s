@@ -11,6 +11,59 @@
 .syntax unified
 .include "macros.inc"
 
+@ Backward copy ending at r1 (rounded down to a word, partial last word
+@ already in r12) into word aligned end r0, recombining each pair of source
+@ words with a shift
+@ \shift = 8 * (original r1 & 3)
+@ Expects r4-r11 to have been pushed, pops them and finishes the byte head
+.macro rmemcpy_shift shift
+.Lshift_\shift:
+    subs    r2, r2, #32
+    blt     2f
+1:
+    ldmdb   r1!, {r4-r11}
+    lsl     r12, r12, #(32 - \shift)
+    orr     r12, r12, r11, lsr #\shift
+    lsl     r11, r11, #(32 - \shift)
+    orr     r11, r11, r10, lsr #\shift
+    lsl     r10, r10, #(32 - \shift)
+    orr     r10, r10, r9, lsr #\shift
+    lsl     r9, r9, #(32 - \shift)
+    orr     r9, r9, r8, lsr #\shift
+    lsl     r8, r8, #(32 - \shift)
+    orr     r8, r8, r7, lsr #\shift
+    lsl     r7, r7, #(32 - \shift)
+    orr     r7, r7, r6, lsr #\shift
+    lsl     r6, r6, #(32 - \shift)
+    orr     r6, r6, r5, lsr #\shift
+    lsl     r5, r5, #(32 - \shift)
+    orr     r5, r5, r4, lsr #\shift
+    stmdb   r0!, {r5-r12}
+    mov     r12, r4
+    subs    r2, r2, #32
+    bge     1b
+2:
+    @ r2 = remaining - 4
+    adds    r2, r2, #28
+    blt     4f
+3:
+    ldr     r4, [r1, #-4]!
+    lsl     r3, r12, #(32 - \shift)
+    orr     r3, r3, r4, lsr #\shift
+    mov     r12, r4
+    str     r3, [r0, #-4]!
+    subs    r2, r2, #4
+    bge     3b
+4:
+    @ Rewind r0, r1 to the start of the remaining head
+    add     r2, r2, #4
+    add     r1, r1, #(\shift / 8)
+    sub     r0, r0, r2
+    sub     r1, r1, r2
+    pop     {r4-r11}
+    b       __agbabi_rmemcpy1
+.endm
+
     .arm
     .align 2
 
@@ -22,7 +75,7 @@ __agbabi_rmemcpy:
     cmp     r2, #6
     ble     __agbabi_rmemcpy1
 
-    align_switch r0, r1, r3, __agbabi_rmemcpy1, .Lcopy_halves
+    align_switch r0, r1, r3, .Lcopy_shift_byte, .Lcopy_shift_half
 
     @ Check if end needs word aligning
     add     r3, r0, r2
@@ -105,3 +158,46 @@ __agbabi_rmemcpy1:
     strbge  r3, [r0, r2]
     bgt     __agbabi_rmemcpy1
     bx      lr
+
+.Lcopy_shift_half:
+    @ <32-bytes is roughly the threshold when half-by-half copy is faster
+    cmp     r2, #32
+    blt     .Lcopy_halves
+    b       .Lcopy_shift
+
+.Lcopy_shift_byte:
+    @ <12-bytes is roughly the threshold when byte-by-byte copy is faster
+    cmp     r2, #12
+    blt     __agbabi_rmemcpy1
+
+.Lcopy_shift:
+    @ Copy byte tail to word align end of r0
+    add     r3, r0, r2
+    joaobapt_test r3
+    submi   r2, r2, #1
+    ldrbmi  r3, [r1, r2]
+    strbmi  r3, [r0, r2]
+    subcs   r2, r2, #2
+    addcs   r12, r2, #1
+    ldrbcs  r3, [r1, r12]
+    strbcs  r3, [r0, r12]
+    ldrbcs  r3, [r1, r2]
+    strbcs  r3, [r0, r2]
+    @ End of r0 is now word aligned, end of r1 is 1, 2, or 3 bytes past a word
+
+    @ Move r0, r1 to the end, round r1 down and keep the partial last word in r12
+    add     r0, r0, r2
+    add     r1, r1, r2
+    and     r3, r1, #3
+    bic     r1, r1, #3
+    push    {r4-r11}
+    ldr     r12, [r1]
+
+    cmp     r3, #2
+    beq     .Lshift_16
+    bhi     .Lshift_24
+    @ Fallthrough
+
+    rmemcpy_shift 8
+    rmemcpy_shift 16
+    rmemcpy_shift 24
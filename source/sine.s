@@ -1,7 +1,8 @@
 @===============================================================================
 @
 @ Support:
-@    __agbabi_sin
+@    __agbabi_sin, __agbabi_sincos, __agbabi_sin_array, __agbabi_sin5,
+@    __agbabi_sin_lut
 @
 @ Taken from coranac.com/2009/07/sines by Jasper "cearn" Vijn
 @ Modified for libagbabi
@@ -9,6 +10,7 @@
 @===============================================================================
 
 .syntax unified
+.include "macros.inc"
 
     .arm
     .align 2
@@ -17,12 +19,147 @@
     .global __agbabi_sin
     .type __agbabi_sin, %function
 __agbabi_sin:
+    sin_q29 r0, r0, r1
+    bx      lr
+
+    .section .iwram.__agbabi_sincos, "ax", %progbits
+    .global __agbabi_sincos
+    .type __agbabi_sincos, %function
+__agbabi_sincos:
+    @ Cosine is a quarter turn ahead
+    add     r1, r0, #0x2000
+    sin_q29 r0, r0, r2
+    sin_q29 r1, r1, r3
+    bx      lr
+
+    .section .iwram.__agbabi_sin_array, "ax", %progbits
+    .global __agbabi_sin_array
+    .type __agbabi_sin_array, %function
+__agbabi_sin_array:
+    @ r0 = dest, r1 = angle, r2 = step, r3 = n
+    push    {r4-r5}
+    subs    r3, r3, #2
+    blo     .Lsin_array_tail
+
+.Lsin_array_pair:
+    sin_q29 r4, r1, r12
+    add     r1, r1, r2
+    sin_q29 r5, r1, r12
+    add     r1, r1, r2
+    stmia   r0!, {r4-r5}
+    subs    r3, r3, #2
+    bhs     .Lsin_array_pair
+
+.Lsin_array_tail:
+    @ r3 is -1 when one angle remains
+    tst     r3, #1
+    beq     .Lsin_array_done
+    sin_q29 r12, r1, r4
+    str     r12, [r0]
+
+.Lsin_array_done:
+    pop     {r4-r5}
+    bx      lr
+
+    .section .iwram.__agbabi_sin5, "ax", %progbits
+    .global __agbabi_sin5
+    .type __agbabi_sin5, %function
+__agbabi_sin5:
+    @ Reflect into -0x2000 to +0x2000, as Q13 quarter turns
     lsl     r0, r0, #17
     teq     r0, r0, lsl #1
     rsbmi   r0, r0, #0x80000000
     asr     r0, r0, #17
-    mul     r1, r0, r0
-    asr     r1, r1, #11
-    rsb     r1, r1, #0x18000
+
+    @ x * (a - x^2 * (b - x^2 * c)), exactly 1 at a quarter turn
+    adr     r12, .Lsin5_coefficients
+    ldmia   r12, {r1-r3}
+    mul     r12, r0, r0
+    asr     r12, r12, #10
+    mul     r3, r12, r3
+    sub     r2, r2, r3, asr #16
+    mul     r3, r2, r12
+    sub     r1, r1, r3, asr #15
     mul     r0, r1, r0
     bx      lr
+
+.Lsin5_coefficients:
+    .word   102906      @ a, Q16
+    .word   21028       @ b, Q15
+    .word   2345        @ c, Q15
+
+    .section .iwram.__agbabi_sin_lut, "ax", %progbits
+    .global __agbabi_sin_lut
+    .type __agbabi_sin_lut, %function
+__agbabi_sin_lut:
+    @ Reflect into -0x2000 to +0x2000, as Q30 quarter turns
+    lsl     r0, r0, #17
+    teq     r0, r0, lsl #1
+    rsbmi   r0, r0, #0x80000000
+
+    @ Interpolate the magnitude, the flags keep the sign until the end
+    cmp     r0, #0
+    rsblt   r0, r0, #0
+    ldr     r1, .Lsin_lut_table_address
+    lsr     r2, r0, #22
+    add     r1, r1, r2, lsl #2
+    ldmia   r1, {r1, r2}
+    sub     r2, r2, r1
+    and     r0, r0, #0x1f << 17
+    lsr     r0, r0, #17
+    mul     r2, r0, r2
+    add     r0, r1, r2, asr #5
+    rsblt   r0, r0, #0
+    bx      lr
+
+.Lsin_lut_table_address:
+    .word   .Lsin_lut_table
+
+    .section .rodata.__agbabi_sin_lut, "a", %progbits
+    .align 2
+    @ Q29 sine of each 256th of a quarter turn
+    @ The last entry repeats 1.0, so a quarter turn can load a pair
+.Lsin_lut_table:
+    .word   0x00000000, 0x003243e2, 0x00648748, 0x0096c9b6, 0x00c90ab0, 0x00fb49ba
+    .word   0x012d8657, 0x015fc00d, 0x0191f65f, 0x01c428d1, 0x01f656e8, 0x02288027
+    .word   0x025aa412, 0x028cc22f, 0x02beda01, 0x02f0eb0d, 0x0322f4d8, 0x0354f6e5
+    .word   0x0386f0b9, 0x03b8e1d9, 0x03eac9cb, 0x041ca812, 0x044e7c34, 0x048045b5
+    .word   0x04b2041c, 0x04e3b6ec, 0x05155dac, 0x0546f7e1, 0x05788511, 0x05aa04c1
+    .word   0x05db7678, 0x060cd9ba, 0x063e2e0f, 0x066f72fd, 0x06a0a809, 0x06d1ccbc
+    .word   0x0702e09b, 0x0733e32d, 0x0764d3f9, 0x0795b288, 0x07c67e5f, 0x07f73707
+    .word   0x0827dc07, 0x08586ce8, 0x0888e931, 0x08b9506c, 0x08e9a220, 0x0919ddd6
+    .word   0x094a0317, 0x097a116d, 0x09aa0861, 0x09d9e77d, 0x0a09ae4a, 0x0a395c53
+    .word   0x0a68f121, 0x0a986c40, 0x0ac7cd3b, 0x0af7139c, 0x0b263eef, 0x0b554ebf
+    .word   0x0b844298, 0x0bb31a08, 0x0be1d499, 0x0c1071d8, 0x0c3ef153, 0x0c6d5297
+    .word   0x0c9b9532, 0x0cc9b8b1, 0x0cf7bca2, 0x0d25a094, 0x0d536416, 0x0d8106b6
+    .word   0x0dae8805, 0x0ddbe792, 0x0e0924ec, 0x0e363fa5, 0x0e63374d, 0x0e900b74
+    .word   0x0ebcbbae, 0x0ee9478a, 0x0f15ae9c, 0x0f41f075, 0x0f6e0ca9, 0x0f9a02cb
+    .word   0x0fc5d26e, 0x0ff17b26, 0x101cfc87, 0x10485627, 0x10738799, 0x109e9074
+    .word   0x10c9704d, 0x10f426bb, 0x111eb354, 0x114915af, 0x11734d64, 0x119d5a0a
+    .word   0x11c73b3a, 0x11f0f08c, 0x121a7999, 0x1243d5fc, 0x126d054d, 0x12960727
+    .word   0x12bedb26, 0x12e780e4, 0x130ff7fd, 0x1338400d, 0x136058b1, 0x13884186
+    .word   0x13affa29, 0x13d78239, 0x13fed953, 0x1425ff18, 0x144cf325, 0x1473b51c
+    .word   0x149a449c, 0x14c0a146, 0x14e6cabc, 0x150cc09f, 0x15328293, 0x15581039
+    .word   0x157d6935, 0x15a28d2a, 0x15c77bbe, 0x15ec3496, 0x1610b755, 0x163503a3
+    .word   0x16591926, 0x167cf785, 0x16a09e66, 0x16c40d74, 0x16e74455, 0x170a42b3
+    .word   0x172d0838, 0x174f948e, 0x1771e75f, 0x17940057, 0x17b5df22, 0x17d7836d
+    .word   0x17f8ece3, 0x181a1b34, 0x183b0e0c, 0x185bc51b, 0x187c4010, 0x189c7e9a
+    .word   0x18bc806b, 0x18dc4533, 0x18fbcca4, 0x191b1670, 0x193a224a, 0x1958efe5
+    .word   0x19777ef5, 0x1995cf2f, 0x19b3e048, 0x19d1b1f6, 0x19ef43ef, 0x1a0c95eb
+    .word   0x1a29a7a0, 0x1a4678c8, 0x1a63091b, 0x1a7f5853, 0x1a9b6629, 0x1ab73259
+    .word   0x1ad2bc9e, 0x1aee04b4, 0x1b090a58, 0x1b23cd47, 0x1b3e4d3f, 0x1b5889ff
+    .word   0x1b728345, 0x1b8c38d2, 0x1ba5aa67, 0x1bbed7c5, 0x1bd7c0ac, 0x1bf064e1
+    .word   0x1c08c426, 0x1c20de40, 0x1c38b2f2, 0x1c504201, 0x1c678b35, 0x1c7e8e52
+    .word   0x1c954b21, 0x1cabc16a, 0x1cc1f0f4, 0x1cd7d98a, 0x1ced7af4, 0x1d02d4ff
+    .word   0x1d17e774, 0x1d2cb221, 0x1d4134d1, 0x1d556f53, 0x1d696174, 0x1d7d0b03
+    .word   0x1d906bcf, 0x1da383a9, 0x1db65262, 0x1dc8d7cb, 0x1ddb13b7, 0x1ded05f8
+    .word   0x1dfeae62, 0x1e100cca, 0x1e212105, 0x1e31eae8, 0x1e426a4b, 0x1e529f04
+    .word   0x1e6288ec, 0x1e7227db, 0x1e817bab, 0x1e908436, 0x1e9f4157, 0x1eadb2e9
+    .word   0x1ebbd8c9, 0x1ec9b2d4, 0x1ed740e7, 0x1ee482e2, 0x1ef178a4, 0x1efe220c
+    .word   0x1f0a7efc, 0x1f168f54, 0x1f2252f7, 0x1f2dc9c9, 0x1f38f3ac, 0x1f43d086
+    .word   0x1f4e603b, 0x1f58a2b1, 0x1f6297d0, 0x1f6c3f7e, 0x1f7599a4, 0x1f7ea62a
+    .word   0x1f8764fa, 0x1f8fd600, 0x1f97f925, 0x1f9fce56, 0x1fa7557f, 0x1fae8e8e
+    .word   0x1fb57972, 0x1fbc1618, 0x1fc26471, 0x1fc8646d, 0x1fce15fd, 0x1fd37914
+    .word   0x1fd88da4, 0x1fdd53a0, 0x1fe1cafd, 0x1fe5f3af, 0x1fe9cdad, 0x1fed58ed
+    .word   0x1ff09566, 0x1ff38310, 0x1ff621e3, 0x1ff871db, 0x1ffa72f0, 0x1ffc251e
+    .word   0x1ffd8861, 0x1ffe9cb4, 0x1fff6217, 0x1fffd886, 0x20000000, 0x20000000
@@ -1,7 +1,7 @@
 @===============================================================================
 @
 @ Support:
-@    __agbabi_sqrt
+@    __agbabi_sqrt, __agbabi_sqrt64, __agbabi_rsqrt
 @
 @ Taken from pertinentdetail.org/sqrt by Wilco Dijkstra
 @ Modified for libagbabi
@@ -41,3 +41,129 @@ __agbabi_sqrt:
 
     bic     r0, r2, #3 << 30
     bx      lr
+
+    .section .iwram.__agbabi_sqrt64, "ax", %progbits
+    .global __agbabi_sqrt64
+    .type __agbabi_sqrt64, %function
+__agbabi_sqrt64:
+    @ Below 2^32 the 32-bit routine gives the same result
+    cmp     r1, #0
+    beq     __agbabi_sqrt
+
+    mov     r3, #3 << 30
+    mov     r2, #1 << 30
+
+    @ The top 16 bits of the root come from the high word alone
+    @ Jump forward if the high word is within 1/2/3 bytes
+    @ 8-bit check
+    lsrs    r12, r1, #8
+    addeq   pc, pc, #(48 * 3) + 12
+    @ 16-bit check
+    lsrs    r12, r1, #16
+    addeq   pc, pc, #(48 * 2) + 4
+    @ 24-bit check
+    lsrs    r12, r1, #24
+    addeq   pc, pc, #(48 * 1) - 4
+
+    .set i, 0
+    .rept 16
+        cmp     r1, r2, ror #2 * i
+        subhs   r1, r1, r2, ror #2 * i
+        adc     r2, r3, r2, lsl #1
+        .set i, i + 1
+    .endr
+
+    @ r1:r0 = remainder, r2 = root so far
+    @ Each trial subtracts (root * 4 + 1) << 2i, which needs both words
+    bic     r2, r2, #3 << 30
+
+    .set i, 15
+    .rept 16
+        .if i == 15
+            subs    r3, r0, #1 << 30
+            sbcs    r12, r1, r2
+        .else
+            mov     r3, #1 << (2 * i)
+            orr     r3, r3, r2, lsl #(2 * i + 2)
+            subs    r3, r0, r3
+            sbcs    r12, r1, r2, lsr #(30 - 2 * i)
+        .endif
+        movhs   r0, r3
+        movhs   r1, r12
+        adc     r2, r2, r2
+        .set i, i - 1
+    .endr
+
+    mov     r0, r2
+    bx      lr
+
+    .section .iwram.__agbabi_rsqrt, "ax", %progbits
+    .global __agbabi_rsqrt
+    .type __agbabi_rsqrt, %function
+__agbabi_rsqrt:
+    @ 1/16 and below does not fit Q30, saturate
+    cmp     r0, #0x1000
+    mvnls   r0, #0
+    bxls    lr
+
+    @ Shift an even amount r1 so that r0 is Q30 between 1 and 4
+    mov     r1, #0
+    cmp     r0, #1 << 16
+    lsllo   r0, r0, #16
+    addlo   r1, r1, #16
+    cmp     r0, #1 << 24
+    lsllo   r0, r0, #8
+    addlo   r1, r1, #8
+    cmp     r0, #1 << 28
+    lsllo   r0, r0, #4
+    addlo   r1, r1, #4
+    cmp     r0, #1 << 30
+    lsllo   r0, r0, #2
+    addlo   r1, r1, #2
+
+    @ r3 = Q16 seed from the top 8 bits
+    adr     r2, .Lrsqrt_seed
+    lsr     r3, r0, #24
+    add     r2, r2, r3, lsl #1
+    ldrh    r3, [r2, #-128]
+
+    @ Newton step, y = y * (3 - x * y * y) / 2
+    mul     r2, r3, r3
+    umull   r12, r2, r0, r2
+    rsb     r2, r2, #3 << 30
+    umull   r12, r2, r3, r2
+    lsr     r12, r12, #16
+    orr     r0, r12, r2, lsl #16
+
+    @ r0 is now Q31, undo half the normalizing shift
+    lsr     r1, r1, #1
+    rsbs    r1, r1, #8
+    lsrpl   r0, r0, r1
+    lslmi   r0, r0, #1
+    bx      lr
+
+.Lrsqrt_seed:
+    .hword  0xff02, 0xfd0e, 0xfb25, 0xf947, 0xf773, 0xf5aa, 0xf3ea, 0xf234
+    .hword  0xf087, 0xeee3, 0xed47, 0xebb3, 0xea27, 0xe8a3, 0xe727, 0xe5b2
+    .hword  0xe443, 0xe2dc, 0xe17a, 0xe020, 0xdecb, 0xdd7d, 0xdc34, 0xdaf1
+    .hword  0xd9b3, 0xd87b, 0xd748, 0xd61a, 0xd4f1, 0xd3cd, 0xd2ad, 0xd192
+    .hword  0xd07b, 0xcf69, 0xce5b, 0xcd51, 0xcc4a, 0xcb48, 0xca4a, 0xc94f
+    .hword  0xc858, 0xc764, 0xc674, 0xc587, 0xc49d, 0xc3b7, 0xc2d4, 0xc1f4
+    .hword  0xc116, 0xc03c, 0xbf65, 0xbe90, 0xbdbe, 0xbcef, 0xbc23, 0xbb59
+    .hword  0xba91, 0xb9cc, 0xb90a, 0xb84a, 0xb78c, 0xb6d0, 0xb617, 0xb560
+    .hword  0xb4ab, 0xb3f8, 0xb347, 0xb298, 0xb1eb, 0xb140, 0xb097, 0xaff0
+    .hword  0xaf4b, 0xaea8, 0xae06, 0xad66, 0xacc8, 0xac2b, 0xab90, 0xaaf7
+    .hword  0xaa5f, 0xa9c9, 0xa934, 0xa8a1, 0xa810, 0xa780, 0xa6f1, 0xa664
+    .hword  0xa5d8, 0xa54d, 0xa4c4, 0xa43c, 0xa3b6, 0xa330, 0xa2ac, 0xa22a
+    .hword  0xa1a8, 0xa128, 0xa0a9, 0xa02b, 0x9fae, 0x9f32, 0x9eb8, 0x9e3e
+    .hword  0x9dc6, 0x9d4e, 0x9cd8, 0x9c63, 0x9bef, 0x9b7b, 0x9b09, 0x9a98
+    .hword  0x9a28, 0x99b8, 0x994a, 0x98dd, 0x9870, 0x9804, 0x979a, 0x9730
+    .hword  0x96c7, 0x965e, 0x95f7, 0x9591, 0x952b, 0x94c6, 0x9462, 0x93ff
+    .hword  0x939c, 0x933a, 0x92d9, 0x9279, 0x9219, 0x91bb, 0x915d, 0x90ff
+    .hword  0x90a3, 0x9047, 0x8feb, 0x8f91, 0x8f37, 0x8edd, 0x8e85, 0x8e2d
+    .hword  0x8dd5, 0x8d7e, 0x8d28, 0x8cd3, 0x8c7e, 0x8c2a, 0x8bd6, 0x8b83
+    .hword  0x8b30, 0x8ade, 0x8a8d, 0x8a3c, 0x89eb, 0x899c, 0x894c, 0x88fe
+    .hword  0x88af, 0x8862, 0x8815, 0x87c8, 0x877c, 0x8730, 0x86e5, 0x869a
+    .hword  0x8650, 0x8606, 0x85bd, 0x8574, 0x852c, 0x84e4, 0x849d, 0x8456
+    .hword  0x840f, 0x83c9, 0x8384, 0x833f, 0x82fa, 0x82b5, 0x8271, 0x822e
+    .hword  0x81eb, 0x81a8, 0x8166, 0x8124, 0x80e2, 0x80a1, 0x8060, 0x8020
@@ -11,6 +11,7 @@
 @===============================================================================
 
 .syntax unified
+.include "macros.inc"
 
     .arm
     .align 2
@@ -40,44 +41,9 @@ __agbabi_unsafe_uidivmod:
     movlo   r0, #0    @ quot = 0
     bxlo    lr
 
-    @ Move the denominator to r2 and start to build a counter that
-    @ counts the difference on the number of bits on each numerator
-    @ and denominator
-    @ From now on: r0 = quot/num, r1 = mod, r2 = denom, r3 = counter
+    @ From now on: r0 = quot/num, r1 = mod, r2 = denom
     mov     r2, r1
-    mov     r3, #28             @ first guess on difference
-    lsr     r1, r0, #4          @ r1 = num >> 4
-
-    @ Iterate three times to get the counter up to 4-bit precision
-    cmp     r2, r1, lsr #12
-    suble   r3, r3, #16
-    lsrle   r1, r1, #16
-
-    cmp     r2, r1, lsr #4
-    suble   r3, r3, #8
-    lsrle   r1, r1, #8
-
-    cmp     r2, r1
-    suble   r3, r3, #4
-    lsrle   r1, r1, #4
-
-    @ shift the numerator by the counter and flip the sign of the denom
-    lsl     r0, r0, r3
-    adds    r0, r0, r0
-    rsb     r2, r2, #0
-
-    @ dynamically jump to the exact copy of the iteration
-    add     r3, r3, r3, lsl #1      @ counter *= 3
-    add     pc, pc, r3, lsl #2      @ jump
-    mov     r0, r0                  @ pipelining issues
-
-    @ here, r0 = num << (r3 + 1), r1 = num >> (32-r3), r2 = -denom
-    @ now, the real iteration part
-    .rept 32
-    adcs    r1, r2, r1, lsl #1
-    sublo   r1, r1, r2
-    adcs    r0, r0, r0
-    .endr
+    uidivmod r0, r1, r2, r2, r3
 
     @ and then finally quit
     @ r0 = quotient, r1 = remainder
@@ -47,7 +47,8 @@ __agbabi_unsafe_uldivmod:
     @ The fact that r3 != 0 gives us a nice optimization
     @ Since the quotient will then be 32-bit, we only need to use a
     @ 96-bit "numerator train", and it will finish nicely in 32 iterations
-    push    {r4-r5}                 @ reserve space
+    push    {r4-r6}                 @ reserve space
+    mov     r6, r3                  @ keep the high word of the denominator for the counter
     rsbs    r4, r2, #0              @ negate the denominator
     mov     r2, r1                  @ move the "numerator train" into place
     rsc     r1, r3, #0              @ negate with carry, to do the right task
@@ -60,21 +61,23 @@ __agbabi_unsafe_uldivmod:
     lsr     r3, r2, #2
 
     @ Iterate four times to get the counter up to 4-bit precision
-    cmn     r1, r3, lsr #14     @ if denom <= (r1 >> 12)
-    subge   r5, r5, #16         @ then -denom >= -(r1 >> 12)
-    lsrge   r3, r3, #16
+    @ A high word equal to the denominator's may still be the larger number,
+    @ so equality counts as needing the extra iterations
+    cmp     r6, r3, lsr #14    @ if denom_hi <= (r2 >> 16)
+    subls   r5, r5, #16
+    lsrls   r3, r3, #16
 
-    cmn     r1, r3, lsr #6
-    subge   r5, r5, #8
-    lsrge   r3, r3, #8
+    cmp     r6, r3, lsr #6
+    subls   r5, r5, #8
+    lsrls   r3, r3, #8
 
-    cmn     r1, r3, lsr #2
-    subge   r5, r5, #4
-    lsrge   r3, r3, #4
+    cmp     r6, r3, lsr #2
+    subls   r5, r5, #4
+    lsrls   r3, r3, #4
 
-    cmn     r1, r3
-    subge   r5, r5, #2
-    lsrge   r3, r3, #2
+    cmp     r6, r3
+    subls   r5, r5, #2
+    lsrls   r3, r3, #2
 
     @ shift the rest of the numerator by the counter
     lsl     r2, r2, r5              @ r1 << r3
@@ -104,7 +107,7 @@ __agbabi_unsafe_uldivmod:
 
     @ from here, r0 = quotient, r2:r3 = remainder
     @ so it's just a matter of setting r1 = 0
-    pop     {r4-r5}
+    pop     {r4-r6}
     mov     r1, #0
     bx      lr
 
@@ -40,6 +40,10 @@ __agbabi_unsafe_uluidivmod:
     cmp     r1, #0
     beq     .LbridgeTo32
 
+    @ The remainder needs 33 bits while shifting when the denominator's top bit is set
+    cmp     r2, #0
+    blt     .LlargeDenominator
+
     @ Move the denominator to r3 and start to build a counter that
     @ counts the difference on the number of bits on the high side
     @ of the numerator and the denominator
@@ -101,3 +105,24 @@ __agbabi_unsafe_uluidivmod:
     mov     r1, #0          @ zero-out the most significant words
     mov     r3, #0          @ same for the remainder
     bx      lr              @ and quit
+
+.LlargeDenominator:
+    @ r0 = quot0/num0, r1 = quot1, r2 = remainder, r3 = denom
+    @ The high word of the quotient is 0 or 1
+    mov     r3, r2
+    subs    r2, r1, r3
+    movlo   r2, r1
+    movlo   r1, #0
+    movhs   r1, #1
+
+    @ The carry out of the remainder shift is its 33rd bit
+    .rept 32
+    adds    r0, r0, r0
+    adcs    r2, r2, r2
+    cmpcc   r2, r3
+    subcs   r2, r2, r3
+    orrcs   r0, r0, #1
+    .endr
+
+    mov     r3, #0                  @ for compatibility with the 64vs64 division
+    bx      lr
@@ -0,0 +1,110 @@
+@===============================================================================
+@
+@ ABI:
+@    __aeabi_uread4, __aeabi_uwrite4, __aeabi_uread8, __aeabi_uwrite8
+@
+@ Copyright (C) 2021-2023 agbabi contributors
+@ For conditions of distribution and use, see copyright notice in LICENSE.md
+@
+@===============================================================================
+
+.syntax unified
+
+    .arm
+    .align 2
+
+    .section .iwram.__aeabi_uread4, "ax", %progbits
+    .global __aeabi_uread4
+    .type __aeabi_uread4, %function
+__aeabi_uread4:
+    ands    r1, r0, #3
+    ldreq   r0, [r0]
+    bxeq    lr
+
+    @ Combine the two aligned words holding the value
+    bic     r0, r0, #3
+    ldmia   r0, {r2, r3}
+    lsl     r1, r1, #3
+    lsr     r0, r2, r1
+    rsb     r1, r1, #32
+    orr     r0, r0, r3, lsl r1
+    bx      lr
+
+    .section .iwram.__aeabi_uread8, "ax", %progbits
+    .global __aeabi_uread8
+    .type __aeabi_uread8, %function
+__aeabi_uread8:
+    ands    r1, r0, #3
+    ldmiaeq r0, {r0, r1}
+    bxeq    lr
+
+    @ Combine the three aligned words holding the value
+    bic     r0, r0, #3
+    ldmia   r0, {r2, r3, r12}
+    lsl     r1, r1, #3
+    lsr     r0, r2, r1
+    lsr     r2, r3, r1
+    rsb     r1, r1, #32
+    orr     r0, r0, r3, lsl r1
+    orr     r1, r2, r12, lsl r1
+    bx      lr
+
+    .section .iwram.__aeabi_uwrite4, "ax", %progbits
+    .global __aeabi_uwrite4
+    .type __aeabi_uwrite4, %function
+__aeabi_uwrite4:
+    tst     r1, #1
+    bne     .Luwrite4_bytes
+    tst     r1, #2
+    streq   r0, [r1]
+    bxeq    lr
+
+    strh    r0, [r1]
+    lsr     r2, r0, #16
+    strh    r2, [r1, #2]
+    bx      lr
+
+.Luwrite4_bytes:
+    strb    r0, [r1]
+    lsr     r2, r0, #8
+    strb    r2, [r1, #1]
+    lsr     r2, r0, #16
+    strb    r2, [r1, #2]
+    lsr     r2, r0, #24
+    strb    r2, [r1, #3]
+    bx      lr
+
+    .section .iwram.__aeabi_uwrite8, "ax", %progbits
+    .global __aeabi_uwrite8
+    .type __aeabi_uwrite8, %function
+__aeabi_uwrite8:
+    tst     r2, #1
+    bne     .Luwrite8_bytes
+    tst     r2, #2
+    stmiaeq r2, {r0, r1}
+    bxeq    lr
+
+    strh    r0, [r2]
+    lsr     r3, r0, #16
+    strh    r3, [r2, #2]
+    strh    r1, [r2, #4]
+    lsr     r3, r1, #16
+    strh    r3, [r2, #6]
+    bx      lr
+
+.Luwrite8_bytes:
+    strb    r0, [r2]
+    lsr     r3, r0, #8
+    strb    r3, [r2, #1]
+    lsr     r3, r0, #16
+    strb    r3, [r2, #2]
+    lsr     r3, r0, #24
+    strb    r3, [r2, #3]
+    strb    r1, [r2, #4]
+    lsr     r3, r1, #8
+    strb    r3, [r2, #5]
+    lsr     r3, r1, #16
+    strb    r3, [r2, #6]
+    lsr     r3, r1, #24
+    strb    r3, [r2, #7]
+    bx      lr
@@ -0,0 +1,127 @@
+/*
+===============================================================================
+
+ Support:
+    __agbabi_vram_memcpy, __agbabi_vram_memset
+
+ Copyright (C) 2021-2023 agbabi contributors
+ For conditions of distribution and use, see copyright notice in LICENSE.md
+
+===============================================================================
+*/
+
+#include <aeabi.h>
+#include <agbabi.h>
+
+typedef unsigned char u8;
+typedef unsigned short u16;
+typedef volatile u16 vu16;
+typedef unsigned int u32;
+
+/* Below this, mismatched bodies are copied half-by-half rather than by __agbabi_memcpy */
+#define SHIFT_THRESHOLD (32u)
+
+static inline __attribute__((always_inline)) u16 read_half(const u8* src) {
+    if ((u32) src & 1) {
+        return (u16) (src[0] | (src[1] << 8));
+    }
+    return *(const u16*) src;
+}
+
+void __attribute__((section(".iwram.__agbabi_vram_memcpy"))) __agbabi_vram_memcpy(void* __restrict__ dest, const void* __restrict__ src, size_t n) {
+    u8* d = (u8*) dest;
+    const u8* s = (const u8*) src;
+
+    if (n == 0) {
+        return;
+    }
+
+    /* Merge byte head into the high byte of its halfword */
+    if ((u32) d & 1) {
+        vu16* half = (vu16*) (d - 1);
+        *half = (u16) ((*half & 0x00ff) | (*s << 8));
+        ++d;
+        ++s;
+        --n;
+    }
+
+    /* Copy half head to word align d */
+    if (((u32) d & 2) && n >= 2) {
+        *(vu16*) d = read_half(s);
+        d += 2;
+        s += 2;
+        n -= 2;
+    }
+
+    /* d is now word aligned, so whole word bodies never need byte stores */
+    const size_t body = n & ~3u;
+    if (((u32) s & 3) == 0) {
+        __aeabi_memcpy4(d, s, body);
+    } else if (body >= SHIFT_THRESHOLD) {
+        __agbabi_memcpy(d, s, body);
+    } else if (((u32) s & 1) == 0) {
+        __agbabi_memcpy2(d, s, body);
+    } else {
+        for (size_t i = 0; i < body; i += 2) {
+            *(vu16*) (d + i) = read_half(s + i);
+        }
+    }
+    d += body;
+    s += body;
+    n &= 3;
+
+    /* Copy half tail */
+    if (n & 2) {
+        *(vu16*) d = read_half(s);
+        d += 2;
+        s += 2;
+    }
+
+    /* Merge byte tail into the low byte of its halfword */
+    if (n & 1) {
+        vu16* half = (vu16*) d;
+        *half = (u16) ((*half & 0xff00) | *s);
+    }
+}
+
+void __attribute__((section(".iwram.__agbabi_vram_memset"))) __agbabi_vram_memset(void* dest, size_t n, int c) {
+    u8* d = (u8*) dest;
+    const u32 byte = (u32) c & 0xff;
+    const u16 half = (u16) (byte * 0x0101u);
+
+    if (n == 0) {
+        return;
+    }
+
+    /* Merge byte head into the high byte of its halfword */
+    if ((u32) d & 1) {
+        vu16* head = (vu16*) (d - 1);
+        *head = (u16) ((*head & 0x00ff) | (byte << 8));
+        ++d;
+        --n;
+    }
+
+    /* Set half head to word align d */
+    if (((u32) d & 2) && n >= 2) {
+        *(vu16*) d = half;
+        d += 2;
+        n -= 2;
+    }
+
+    const size_t body = n & ~3u;
+    __agbabi_wordset4(d, body, (int) (half * 0x00010001u));
+    d += body;
+    n &= 3;
+
+    /* Set half tail */
+    if (n & 2) {
+        *(vu16*) d = half;
+        d += 2;
+    }
+
+    /* Merge byte tail into the low byte of its halfword */
+    if (n & 1) {
+        vu16* tail = (vu16*) d;
+        *tail = (u16) ((*tail & 0xff00) | byte);
+    }
+}
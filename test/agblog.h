@@ -0,0 +1,28 @@
+#ifndef AGBLOG_H
+#define AGBLOG_H
+
+/* Line output through the mGBA debug registers, also implemented by the headless runner */
+
+#define AGBLOG_ENABLE (*(volatile unsigned short*) 0x4FFF780)
+#define AGBLOG_FLAGS  (*(volatile unsigned short*) 0x4FFF700)
+#define AGBLOG_STRING ((char*) 0x4FFF600)
+
+#define AGBLOG_LEVEL_INFO (3)
+#define AGBLOG_SEND (0x100)
+
+static inline int agblog_init(void) {
+    AGBLOG_ENABLE = 0xC0DE;
+    return AGBLOG_ENABLE == 0x1DEA;
+}
+
+static inline void agblog_write(const char* line) {
+    char* out = AGBLOG_STRING;
+    int i = 0;
+    for (; i < 255 && line[i]; ++i) {
+        out[i] = line[i];
+    }
+    out[i] = 0;
+    AGBLOG_FLAGS = AGBLOG_LEVEL_INFO | AGBLOG_SEND;
+}
+
+#endif /* define AGBLOG_H */
@@ -0,0 +1,486 @@
+#include <tonc.h>
+#include <agbabi.h>
+#include <aeabi.h>
+#include <sys/ucontext.h>
+
+#include "agblog.h"
+
+/*
+ * Cycle benchmarks for every exported routine
+ * Each result is one CSV line written to the debug log:
+ *   routine,region,size,alignment,cycles
+ * region is "src>dest" for memory routines, size is the byte count (or the
+ * input case for arithmetic routines), alignment is "src_offset:dest_offset"
+ * Cycles are measured with cascaded TM0/TM1 and include the call from Thumb ROM
+ */
+
+extern void posprintf(char*, const char*, ...);
+
+/* libgcc helpers replaced by bits.s */
+int __clzsi2(unsigned int x);
+int __ctzsi2(unsigned int x);
+int __popcountsi2(unsigned int x);
+
+#define BUFFER_LEN (1024 + 8)
+
+static char iwram_buffer[2][BUFFER_LEN] __attribute__((aligned(4)));
+static char ewram_buffer[2][BUFFER_LEN] __attribute__((aligned(4))) EWRAM_DATA;
+static const char rom_buffer[BUFFER_LEN] __attribute__((aligned(4))) = {1};
+
+/* Character block 2 is not used by the display */
+#define VRAM_BUFFER ((char*) 0x6008000)
+
+struct region {
+    const char* name;
+    char* base;
+};
+
+static const struct region src_regions[] = {
+    {"iwram", iwram_buffer[0]},
+    {"ewram", ewram_buffer[0]},
+    {"rom", (char*) rom_buffer}
+};
+
+static const struct region dest_regions[] = {
+    {"iwram", iwram_buffer[1]},
+    {"ewram", ewram_buffer[1]},
+    {"vram", VRAM_BUFFER}
+};
+
+#define countof(X) (sizeof(X) / sizeof((X)[0]))
+
+static const size_t sizes[] = {4, 16, 64, 256, 1024};
+
+static const struct {
+    int src;
+    int dest;
+} offsets[] = {{0, 0}, {1, 1}, {2, 2}, {0, 1}, {1, 0}, {0, 2}, {2, 0}, {1, 3}, {3, 1}};
+
+typedef void (*copy_fn)(void*, const void*, size_t);
+typedef void (*set_fn)(void*, size_t, int);
+
+/* align is the required offset alignment, unit is the required size multiple */
+static const struct {
+    const char* name;
+    copy_fn fn;
+    int align;
+    size_t unit;
+} copies[] = {
+    {"__aeabi_memcpy", __aeabi_memcpy, 1, 1},
+    {"__aeabi_memcpy4", __aeabi_memcpy4, 4, 1},
+    {"__agbabi_memcpy2", __agbabi_memcpy2, 2, 1},
+    {"__agbabi_memcpy1", __agbabi_memcpy1, 1, 1},
+    {"__agbabi_rmemcpy", __agbabi_rmemcpy, 1, 1},
+    {"__agbabi_rmemcpy1", __agbabi_rmemcpy1, 1, 1},
+    {"__aeabi_memmove", __aeabi_memmove, 1, 1},
+    {"__aeabi_memmove4", __aeabi_memmove4, 4, 1},
+    {"__agbabi_fiq_memcpy4", __agbabi_fiq_memcpy4, 4, 1},
+    {"__agbabi_fiq_memcpy4x4", __agbabi_fiq_memcpy4x4, 4, 16},
+    {"__agbabi_fiq_rmemcpy4", __agbabi_fiq_rmemcpy4, 4, 1},
+    {"__agbabi_fiq_memmove4", __agbabi_fiq_memmove4, 4, 1},
+    {"__agbabi_dma_memcpy", __agbabi_dma_memcpy, 1, 1},
+    {"__agbabi_dma_memcpy4", __agbabi_dma_memcpy4, 4, 4},
+    {"__agbabi_vram_memcpy", __agbabi_vram_memcpy, 1, 1}
+};
+
+static const struct {
+    const char* name;
+    set_fn fn;
+    int align;
+    size_t unit;
+} sets[] = {
+    {"__aeabi_memset", __aeabi_memset, 1, 1},
+    {"__aeabi_memset4", __aeabi_memset4, 4, 1},
+    {"__agbabi_wordset4", __agbabi_wordset4, 4, 1},
+    {"__agbabi_fiq_memset4", __agbabi_fiq_memset4, 4, 1},
+    {"__agbabi_dma_memset", __agbabi_dma_memset, 1, 1},
+    {"__agbabi_dma_memset4", __agbabi_dma_memset4, 4, 4},
+    {"__agbabi_vram_memset", __agbabi_vram_memset, 1, 1}
+};
+
+static unsigned int overhead;
+
+static inline void timer_start(void) {
+    REG_TM0CNT = 0;
+    REG_TM1CNT = 0;
+    REG_TM0D = 0;
+    REG_TM1D = 0;
+    REG_TM1CNT = TM_ENABLE | TM_CASCADE;
+    REG_TM0CNT = TM_ENABLE;
+}
+
+static inline unsigned int timer_stop(void) {
+    REG_TM0CNT = 0;
+    return ((unsigned int) REG_TM1D << 16) | REG_TM0D;
+}
+
+static void emit(const char* routine, const char* region, const char* size, const char* alignment, unsigned int cycles) {
+    char line[128];
+    posprintf(line, "%s,%s,%s,%s,%l", routine, region, size, alignment, cycles - overhead);
+    agblog_write(line);
+}
+
+static void bench_memory(void) {
+    char region[16];
+    char size[8];
+    char alignment[8];
+
+    for (size_t f = 0; f < countof(copies); ++f) {
+        for (size_t s = 0; s < countof(src_regions); ++s) {
+            for (size_t d = 0; d < countof(dest_regions); ++d) {
+                posprintf(region, "%s>%s", src_regions[s].name, dest_regions[d].name);
+
+                for (size_t n = 0; n < countof(sizes); ++n) {
+                    if (sizes[n] % copies[f].unit) {
+                        continue;
+                    }
+                    posprintf(size, "%d", sizes[n]);
+
+                    for (size_t o = 0; o < countof(offsets); ++o) {
+                        if ((offsets[o].src | offsets[o].dest) % copies[f].align) {
+                            continue;
+                        }
+                        posprintf(alignment, "%d:%d", offsets[o].src, offsets[o].dest);
+
+                        timer_start();
+                        copies[f].fn(dest_regions[d].base + offsets[o].dest, src_regions[s].base + offsets[o].src, sizes[n]);
+                        emit(copies[f].name, region, size, alignment, timer_stop());
+                    }
+                }
+            }
+        }
+    }
+
+    for (size_t f = 0; f < countof(sets); ++f) {
+        for (size_t d = 0; d < countof(dest_regions); ++d) {
+            for (size_t n = 0; n < countof(sizes); ++n) {
+                if (sizes[n] % sets[f].unit) {
+                    continue;
+                }
+                posprintf(size, "%d", sizes[n]);
+
+                for (int o = 0; o < 4; o += sets[f].align) {
+                    posprintf(alignment, "-:%d", o);
+
+                    timer_start();
+                    sets[f].fn(dest_regions[d].base + o, sizes[n], 0xcd);
+                    emit(sets[f].name, dest_regions[d].name, size, alignment, timer_stop());
+                }
+            }
+        }
+    }
+}
+
+/* CPU against DMA around the thresholds in dma.c, from an ewram source */
+static const size_t dma_sizes[] = {256, 512, 768, 832, 896, 1024};
+
+static char ewram_fill_buffer[8192] __attribute__((aligned(4))) EWRAM_DATA;
+
+static void bench_dma_threshold(void) {
+    char region[16];
+    char size[8];
+
+    for (size_t d = 0; d < countof(dest_regions); ++d) {
+        posprintf(region, "ewram>%s", dest_regions[d].name);
+
+        for (size_t n = 0; n < countof(dma_sizes); ++n) {
+            posprintf(size, "%d", dma_sizes[n]);
+
+            timer_start();
+            __aeabi_memcpy4(dest_regions[d].base, ewram_buffer[0], dma_sizes[n]);
+            emit("dma_threshold:__aeabi_memcpy4", region, size, "0:0", timer_stop());
+
+            timer_start();
+            __agbabi_dma_memcpy4(dest_regions[d].base, ewram_buffer[0], dma_sizes[n]);
+            emit("dma_threshold:__agbabi_dma_memcpy4", region, size, "0:0", timer_stop());
+
+            timer_start();
+            __aeabi_memcpy(dest_regions[d].base, ewram_buffer[0] + 2, dma_sizes[n]);
+            emit("dma_threshold:__aeabi_memcpy", region, size, "2:0", timer_stop());
+
+            timer_start();
+            __agbabi_dma_memcpy(dest_regions[d].base, ewram_buffer[0] + 2, dma_sizes[n]);
+            emit("dma_threshold:__agbabi_dma_memcpy", region, size, "2:0", timer_stop());
+
+            timer_start();
+            __aeabi_memset4(dest_regions[d].base, dma_sizes[n], 0xcd);
+            emit("dma_threshold:__aeabi_memset4", dest_regions[d].name, size, "-:0", timer_stop());
+
+            timer_start();
+            __agbabi_dma_memset4(dest_regions[d].base, dma_sizes[n], 0xcd);
+            emit("dma_threshold:__agbabi_dma_memset4", dest_regions[d].name, size, "-:0", timer_stop());
+        }
+    }
+
+    timer_start();
+    __aeabi_memset4(ewram_fill_buffer, sizeof(ewram_fill_buffer), 0xcd);
+    emit("dma_threshold:__aeabi_memset4", "ewram", "8192", "-:0", timer_stop());
+
+    timer_start();
+    __agbabi_dma_memset4(ewram_fill_buffer, sizeof(ewram_fill_buffer), 0xcd);
+    emit("dma_threshold:__agbabi_dma_memset4", "ewram", "8192", "-:0", timer_stop());
+}
+
+/* Calls go through non-const function pointers so they stay between the timer reads */
+#define BENCH_CALL(NAME, CASE, TYPE, FN, ...) \
+    do { \
+        TYPE volatile fn = FN; \
+        timer_start(); \
+        fn(__VA_ARGS__); \
+        emit(NAME, "-", CASE, "-", timer_stop()); \
+    } while (0)
+
+typedef unsigned int (*uidiv_fn)(unsigned int, unsigned int);
+typedef int (*idiv_fn)(int, int);
+typedef unsigned long long __attribute__((vector_size(sizeof(unsigned long long) * 2))) (*uldivmod_fn)(unsigned long long, unsigned long long);
+typedef long long __attribute__((vector_size(sizeof(long long) * 2))) (*ldivmod_fn)(long long, long long);
+typedef unsigned long long (*uluidiv_fn)(unsigned long long, unsigned int);
+typedef long long (*lidiv_fn)(long long, int);
+typedef int (*fxdiv_fn)(int, int);
+typedef float (*float_fn)(float, float);
+typedef float (*i2f_fn)(int);
+typedef float (*l2f_fn)(long long);
+typedef int (*f2iz_fn)(float);
+typedef int (*fcmp_fn)(float, float);
+typedef double (*double_fn)(double, double);
+typedef double (*i2d_fn)(int);
+typedef double (*l2d_fn)(long long);
+typedef int (*d2iz_fn)(double);
+typedef long long (*d2lz_fn)(double);
+typedef int (*dcmp_fn)(double, double);
+typedef unsigned int (*udiv_prepared_fn)(unsigned int, const __agbabi_udiv_t*);
+typedef int (*idiv_prepared_fn)(int, const __agbabi_idiv_t*);
+typedef unsigned long long (*uluidiv_prepared_fn)(unsigned long long, const __agbabi_uluidiv_t*);
+typedef void (*udiv_prepare_fn)(__agbabi_udiv_t*, unsigned int);
+typedef void (*uidiv_array_fn)(unsigned int*, const unsigned int*, unsigned int, size_t);
+typedef void (*idiv_array_fn)(int*, const int*, int, size_t);
+typedef int (*sin_fn)(int);
+typedef int __attribute__((vector_size(sizeof(int) * 2))) (*sincos_fn)(int);
+typedef void (*sin_array_fn)(int*, int, int, size_t);
+typedef unsigned int (*atan2_fn)(int, int);
+typedef void (*atan2_array_fn)(unsigned int*, const int*, size_t);
+typedef void (*obj_affine_set_fn)(const __agbabi_obj_affine_src_t*, void*, size_t, size_t);
+typedef void (*bg_affine_set_fn)(const __agbabi_bg_affine_src_t*, __agbabi_bg_affine_dst_t*, size_t);
+typedef int (*sqrt_fn)(unsigned int);
+typedef unsigned int (*sqrt64_fn)(unsigned long long);
+typedef unsigned int (*rsqrt_fn)(unsigned int);
+typedef unsigned int (*exp2_fn)(int);
+typedef void (*exp2_array_fn)(unsigned int*, int, int, size_t);
+typedef int (*log2_fn)(unsigned int);
+typedef unsigned int (*pow_fn)(unsigned int, int);
+typedef void (*pow_array_fn)(unsigned int*, const unsigned int*, int, size_t);
+typedef int (*bits_fn)(unsigned int);
+typedef char* (*utoa10_fn)(unsigned int, char*);
+typedef char* (*ulltoa10_fn)(unsigned long long, char*);
+
+static void bench_arithmetic(void) {
+    BENCH_CALL("__aeabi_uidiv", "100/7", uidiv_fn, __aeabi_uidiv, 100u, 7u);
+    BENCH_CALL("__aeabi_uidiv", "0xffffffff/3", uidiv_fn, __aeabi_uidiv, 0xffffffffu, 3u);
+    BENCH_CALL("__aeabi_uidiv", "0xffffffff/0x12345", uidiv_fn, __aeabi_uidiv, 0xffffffffu, 0x12345u);
+    BENCH_CALL("__aeabi_idiv", "-1000/7", idiv_fn, __aeabi_idiv, -1000, 7);
+    BENCH_CALL("__aeabi_idiv", "0x7fffffff/-3", idiv_fn, __aeabi_idiv, 0x7fffffff, -3);
+    BENCH_CALL("__aeabi_uldivmod", "1e18/3", uldivmod_fn, __aeabi_uldivmod, 1000000000000000000ull, 3ull);
+    BENCH_CALL("__aeabi_uldivmod", "1e18/1e12", uldivmod_fn, __aeabi_uldivmod, 1000000000000000000ull, 1000000000000ull);
+    BENCH_CALL("__aeabi_ldivmod", "-1e18/3", ldivmod_fn, __aeabi_ldivmod, -1000000000000000000ll, 3ll);
+    BENCH_CALL("__aeabi_ldivmod", "-1000/7", ldivmod_fn, __aeabi_ldivmod, -1000ll, 7ll);
+    BENCH_CALL("__aeabi_ldivmod", "0x12345678/3", ldivmod_fn, __aeabi_ldivmod, 0x12345678ll, 3ll);
+    BENCH_CALL("__agbabi_lidiv", "-1e18/3", lidiv_fn, __agbabi_lidiv, -1000000000000000000ll, 3);
+    BENCH_CALL("__agbabi_fxdiv16", "1.0/3.0", fxdiv_fn, __agbabi_fxdiv16, 0x10000, 0x30000);
+    BENCH_CALL("__agbabi_fxdiv16_approx", "1.0/3.0", fxdiv_fn, __agbabi_fxdiv16_approx, 0x10000, 0x30000);
+    BENCH_CALL("__agbabi_uluidiv", "1e18/3", uluidiv_fn, __agbabi_uluidiv, 1000000000000000000ull, 3u);
+
+    /* Prepared once outside the timed call, as when dividing many numerators */
+    __agbabi_udiv_t div7, div3, div12345;
+    __agbabi_idiv_t idiv7, idiv_3;
+    __agbabi_uluidiv_t uluidiv3;
+    __agbabi_udiv_prepare(&div7, 7u);
+    __agbabi_udiv_prepare(&div3, 3u);
+    __agbabi_udiv_prepare(&div12345, 0x12345u);
+    __agbabi_idiv_prepare(&idiv7, 7);
+    __agbabi_idiv_prepare(&idiv_3, -3);
+    __agbabi_uluidiv_prepare(&uluidiv3, 3u);
+    BENCH_CALL("__agbabi_udiv_prepare", "0x12345", udiv_prepare_fn, __agbabi_udiv_prepare, &div12345, 0x12345u);
+    BENCH_CALL("__agbabi_udiv_prepared", "100/7", udiv_prepared_fn, __agbabi_udiv_prepared, 100u, &div7);
+    BENCH_CALL("__agbabi_udiv_prepared", "0xffffffff/3", udiv_prepared_fn, __agbabi_udiv_prepared, 0xffffffffu, &div3);
+    BENCH_CALL("__agbabi_udiv_prepared", "0xffffffff/0x12345", udiv_prepared_fn, __agbabi_udiv_prepared, 0xffffffffu, &div12345);
+    BENCH_CALL("__agbabi_idiv_prepared", "-1000/7", idiv_prepared_fn, __agbabi_idiv_prepared, -1000, &idiv7);
+    BENCH_CALL("__agbabi_idiv_prepared", "0x7fffffff/-3", idiv_prepared_fn, __agbabi_idiv_prepared, 0x7fffffff, &idiv_3);
+    BENCH_CALL("__agbabi_uluidiv_prepared", "1e18/3", uluidiv_prepared_fn, __agbabi_uluidiv_prepared, 1000000000000000000ull, &uluidiv3);
+
+    /* 64 numerators, compared against one call per element */
+    static unsigned int numerators[64];
+    static unsigned int quotients[64];
+    for (size_t i = 0; i < countof(numerators); ++i) {
+        numerators[i] = (unsigned int) i * 0x1234567u;
+    }
+    {
+        uidiv_fn volatile fn = __aeabi_uidiv;
+        timer_start();
+        for (size_t i = 0; i < countof(numerators); ++i) {
+            quotients[i] = fn(numerators[i], 7u);
+        }
+        emit("__aeabi_uidiv", "-", "64x/7", "-", timer_stop());
+    }
+    {
+        idiv_fn volatile fn = __aeabi_idiv;
+        timer_start();
+        for (size_t i = 0; i < countof(numerators); ++i) {
+            quotients[i] = (unsigned int) fn((int) numerators[i], -7);
+        }
+        emit("__aeabi_idiv", "-", "64x/-7", "-", timer_stop());
+    }
+    BENCH_CALL("__agbabi_uidiv_array", "64x/7", uidiv_array_fn, __agbabi_uidiv_array, quotients, numerators, 7u, countof(numerators));
+    BENCH_CALL("__agbabi_idiv_array", "64x/-7", idiv_array_fn, __agbabi_idiv_array, (int*) quotients, (const int*) numerators, -7, countof(numerators));
+
+    BENCH_CALL("__agbabi_sin", "0x1000", sin_fn, __agbabi_sin, 0x1000);
+    BENCH_CALL("__agbabi_sincos", "0x1000", sincos_fn, __agbabi_sincos, 0x1000);
+    BENCH_CALL("__agbabi_sin5", "0x1000", sin_fn, __agbabi_sin5, 0x1000);
+    BENCH_CALL("__agbabi_sin_lut", "0x1000", sin_fn, __agbabi_sin_lut, 0x1000);
+    BENCH_CALL("__agbabi_atan2", "0x300,0x400", atan2_fn, __agbabi_atan2, 0x300, 0x400);
+    BENCH_CALL("__agbabi_sqrt", "25", sqrt_fn, __agbabi_sqrt, 25u);
+    BENCH_CALL("__agbabi_sqrt", "0xffffffff", sqrt_fn, __agbabi_sqrt, 0xffffffffu);
+    BENCH_CALL("__agbabi_sqrt64", "0x12345678", sqrt64_fn, __agbabi_sqrt64, 0x12345678ull);
+    BENCH_CALL("__agbabi_sqrt64", "0xffffffffffffffff", sqrt64_fn, __agbabi_sqrt64, 0xffffffffffffffffull);
+    BENCH_CALL("__agbabi_rsqrt", "2.0", rsqrt_fn, __agbabi_rsqrt, 0x20000u);
+    BENCH_CALL("__agbabi_exp2", "1.5", exp2_fn, __agbabi_exp2, 0x18000);
+    BENCH_CALL("__agbabi_log2", "3.0", log2_fn, __agbabi_log2, 0x30000u);
+    BENCH_CALL("__agbabi_pow", "3.0^1.5", pow_fn, __agbabi_pow, 0x30000u, 0x18000);
+
+    /* 64 angles, compared against one call per element */
+    static int sines[64];
+    {
+        sin_fn volatile fn = __agbabi_sin;
+        timer_start();
+        for (size_t i = 0; i < countof(sines); ++i) {
+            sines[i] = fn((int) i * 0x200);
+        }
+        emit("__agbabi_sin", "-", "64x", "-", timer_stop());
+    }
+    BENCH_CALL("__agbabi_sin_array", "64x", sin_array_fn, __agbabi_sin_array, sines, 0, 0x200, countof(sines));
+
+    /* 64 coords, compared against one call per element */
+    static int coords[64 * 2];
+    static unsigned int angles[64];
+    for (size_t i = 0; i < countof(angles); ++i) {
+        coords[i * 2] = __agbabi_sin((int) i * 0x200 + 0x2000) >> 17;
+        coords[i * 2 + 1] = __agbabi_sin((int) i * 0x200) >> 17;
+    }
+    {
+        atan2_fn volatile fn = __agbabi_atan2;
+        timer_start();
+        for (size_t i = 0; i < countof(angles); ++i) {
+            angles[i] = fn(coords[i * 2], coords[i * 2 + 1]);
+        }
+        emit("__agbabi_atan2", "-", "64x", "-", timer_stop());
+    }
+    BENCH_CALL("__agbabi_atan2_array", "64x", atan2_array_fn, __agbabi_atan2_array, angles, coords, countof(angles));
+
+    /* 64 step envelope and easing curve */
+    static unsigned int envelope[64];
+    static unsigned int ramp[64];
+    for (size_t i = 0; i < countof(ramp); ++i) {
+        ramp[i] = (unsigned int) i * 0x400;
+    }
+    BENCH_CALL("__agbabi_exp2_array", "64x", exp2_array_fn, __agbabi_exp2_array, envelope, 0, -0x800, countof(envelope));
+    BENCH_CALL("__agbabi_pow_array", "64x^2.5", pow_array_fn, __agbabi_pow_array, envelope, ramp, 0x28000, countof(envelope));
+
+    /* 32 affine matrices, as for every entry of OAM */
+    static __agbabi_obj_affine_src_t obj_affine[32];
+    static unsigned short oam_shadow[512];
+    static const __agbabi_bg_affine_src_t bg_affine = {120 << 8, 80 << 8, 120, 80, 0x100, 0x100, 0x1000, 0};
+    static __agbabi_bg_affine_dst_t bg_affine_dst;
+    for (size_t i = 0; i < countof(obj_affine); ++i) {
+        obj_affine[i] = (__agbabi_obj_affine_src_t) {0x100, 0x100, (unsigned short) (i * 0x800), 0};
+    }
+    BENCH_CALL("__agbabi_obj_affine_set", "32x", obj_affine_set_fn, __agbabi_obj_affine_set, obj_affine, &oam_shadow[3], countof(obj_affine), 8);
+    BENCH_CALL("__agbabi_bg_affine_set", "1x", bg_affine_set_fn, __agbabi_bg_affine_set, &bg_affine, &bg_affine_dst, 1);
+
+    BENCH_CALL("__aeabi_fadd", "1.5+2.25", float_fn, __aeabi_fadd, 1.5f, 2.25f);
+    BENCH_CALL("__aeabi_fsub", "1.5-1.4999999", float_fn, __aeabi_fsub, 1.5f, 1.4999999f);
+    BENCH_CALL("__aeabi_fmul", "1.5*2.25", float_fn, __aeabi_fmul, 1.5f, 2.25f);
+    BENCH_CALL("__aeabi_fdiv", "1.5/2.25", float_fn, __aeabi_fdiv, 1.5f, 2.25f);
+    BENCH_CALL("__aeabi_i2f", "123456789", i2f_fn, __aeabi_i2f, 123456789);
+    BENCH_CALL("__aeabi_l2f", "-1e18", l2f_fn, __aeabi_l2f, -1000000000000000000ll);
+    BENCH_CALL("__aeabi_f2iz", "-12345.6", f2iz_fn, __aeabi_f2iz, -12345.6f);
+    BENCH_CALL("__aeabi_fcmplt", "1.5<2.25", fcmp_fn, __aeabi_fcmplt, 1.5f, 2.25f);
+    BENCH_CALL("__aeabi_dadd", "1.5+2.25", double_fn, __aeabi_dadd, 1.5, 2.25);
+    BENCH_CALL("__aeabi_dsub", "1.5-1.4999999", double_fn, __aeabi_dsub, 1.5, 1.4999999);
+    BENCH_CALL("__aeabi_dmul", "1.5*2.25", double_fn, __aeabi_dmul, 1.5, 2.25);
+    BENCH_CALL("__aeabi_ddiv", "1.5/2.25", double_fn, __aeabi_ddiv, 1.5, 2.25);
+    BENCH_CALL("__aeabi_i2d", "123456789", i2d_fn, __aeabi_i2d, 123456789);
+    BENCH_CALL("__aeabi_l2d", "-1e18", l2d_fn, __aeabi_l2d, -1000000000000000000ll);
+    BENCH_CALL("__aeabi_d2iz", "-12345.6", d2iz_fn, __aeabi_d2iz, -12345.6);
+    BENCH_CALL("__aeabi_d2lz", "-1e18", d2lz_fn, __aeabi_d2lz, -1e18);
+    BENCH_CALL("__aeabi_dcmplt", "1.5<2.25", dcmp_fn, __aeabi_dcmplt, 1.5, 2.25);
+
+    BENCH_CALL("__clzsi2", "0x12345", bits_fn, __clzsi2, 0x12345u);
+    BENCH_CALL("__ctzsi2", "0x12340000", bits_fn, __ctzsi2, 0x12340000u);
+    BENCH_CALL("__popcountsi2", "0xdeadbeef", bits_fn, __popcountsi2, 0xdeadbeefu);
+
+    char digits[21];
+    BENCH_CALL("__agbabi_utoa10", "4294967295", utoa10_fn, __agbabi_utoa10, 4294967295u, digits);
+    BENCH_CALL("__agbabi_ulltoa10", "18446744073709551615", ulltoa10_fn, __agbabi_ulltoa10, 18446744073709551615ull, digits);
+}
+
+static int coro_proc(__agbabi_coro_t* coro) {
+    while (1) {
+        __agbabi_coro_yield(coro, 1);
+    }
+    return 0;
+}
+
+static ucontext_t main_ctx;
+static ucontext_t swap_ctx;
+
+static void swap_proc(void) {
+    while (1) {
+        swapcontext(&swap_ctx, &main_ctx);
+    }
+}
+
+static void bench_context(void) {
+    static int coro_stack[0x100];
+    __agbabi_coro_t coro;
+    __agbabi_coro_make(&coro, coro_stack + countof(coro_stack), coro_proc);
+    __agbabi_coro_resume(&coro); /* Start */
+
+    timer_start();
+    __agbabi_coro_resume(&coro);
+    emit("__agbabi_coro_resume", "-", "resume+yield", "-", timer_stop());
+
+    static int swap_stack[0x100];
+    getcontext(&swap_ctx);
+    swap_ctx.uc_stack.ss_sp = swap_stack;
+    swap_ctx.uc_stack.ss_size = sizeof(swap_stack);
+    swap_ctx.uc_link = &main_ctx;
+    makecontext(&swap_ctx, swap_proc, 0);
+    swapcontext(&main_ctx, &swap_ctx); /* Start */
+
+    timer_start();
+    swapcontext(&main_ctx, &swap_ctx);
+    emit("swapcontext", "-", "swap+swap", "-", timer_stop());
+}
+
+int main(void) {
+    if (!agblog_init()) {
+        REG_DISPCNT = DCNT_MODE0 | DCNT_BG0;
+        tte_init_se(0, BG_CBB(0) | BG_SBB(31), 0, CLR_YELLOW, 14, NULL, NULL);
+        tte_write("Debug output unavailable");
+        Stop();
+    }
+
+    REG_IME = 0;
+
+    timer_start();
+    overhead = timer_stop();
+
+    agblog_write("routine,region,size,alignment,cycles");
+    bench_memory();
+    bench_dma_threshold();
+    bench_arithmetic();
+    bench_context();
+    agblog_write("# end");
+
+    Stop();
+    return 0;
+}
@@ -3,13 +3,25 @@
 #include <aeabi.h>
 
 #include "agbtest.h"
+#include "agblog.h"
 
 static void test_callback(const char* name, int result, const char* message);
 
 AGBTEST_SET(memcpy, test_callback);
 AGBTEST_SET(memset, test_callback);
+AGBTEST_SET(memmove, test_callback);
+AGBTEST_SET(divide, test_callback);
+AGBTEST_SET(itoa, test_callback);
+AGBTEST_SET(bits, test_callback);
+AGBTEST_SET(aeabi, test_callback);
+AGBTEST_SET(math, test_callback);
+
+static int log_enabled;
+static int failures;
 
 int main(void) {
+    log_enabled = agblog_init();
+
     irq_init(NULL);
     irq_add(II_VBLANK, NULL);
     REG_DISPCNT = DCNT_MODE0 | DCNT_BG0;
@@ -34,11 +46,52 @@ int main(void) {
     AGBTEST_RUN(memset);
     tte_write("\n");
 
+    tte_write("memmove ");
+    AGBTEST_RUN(memmove);
+    tte_write("\n");
+
+    tte_write("divide ");
+    AGBTEST_RUN(divide);
+    tte_write("\n");
+
+    tte_write("itoa ");
+    AGBTEST_RUN(itoa);
+    tte_write("\n");
+
+    tte_write("bits ");
+    AGBTEST_RUN(bits);
+    tte_write("\n");
+
+    tte_write("aeabi ");
+    AGBTEST_RUN(aeabi);
+    tte_write("\n");
+
+    tte_write("math ");
+    AGBTEST_RUN(math);
+    tte_write("\n");
+
+    if (log_enabled) {
+        char line[16];
+        posprintf(line, "# exit %d", failures);
+        agblog_write(line);
+    }
+
     key_wait_till_hit(KEY_ANY);
 }
 
 void test_callback(const char* name, int failed, const char* message) {
+    if (log_enabled) {
+        char line[128];
+        if (failed) {
+            posprintf(line, "FAIL %s: %s", name, message);
+        } else {
+            posprintf(line, "PASS %s", name);
+        }
+        agblog_write(line);
+    }
+
     if (failed) {
+        ++failures;
         tte_write("X\n");
         tte_write(name);
         tte_write("\n");
@@ -0,0 +1,322 @@
+/*
+===============================================================================
+
+ agbrun: headless GBA ROM runner for the agbabi test suite
+
+ Usage: agbrun [-c max_cycles] [-t] rom.elf|rom.gba
+
+ Lines written to the mGBA debug registers are printed to stdout
+ A line of "# exit <status>" ends the run with that exit status,
+ as does the Stop BIOS call (with status 0)
+
+ Copyright (C) 2021-2023 agbabi contributors
+ For conditions of distribution and use, see copyright notice in LICENSE.md
+
+===============================================================================
+*/
+
+#include "gba.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ROM_BASE (0x08000000u)
+#define ROM_MAX (0x02000000u)
+
+/* Default limit is ten emulated minutes */
+#define DEFAULT_MAX_CYCLES (16777216ull * 600)
+
+#define STATUS_USAGE (126)
+
+static int load_rom(struct gba* g, const char* path, u32* entry);
+static u32 isqrt(u32 x);
+
+int main(int argc, char* argv[]) {
+    static struct gba g;
+    const char* path = NULL;
+    int print_cycles = 0;
+
+    g.max_cycles = DEFAULT_MAX_CYCLES;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            g.max_cycles = strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "-t") == 0) {
+            print_cycles = 1;
+        } else if (argv[i][0] != '-' && !path) {
+            path = argv[i];
+        } else {
+            path = NULL;
+            break;
+        }
+    }
+
+    if (!path) {
+        fprintf(stderr, "usage: %s [-c max_cycles] [-t] rom.elf|rom.gba\n", argv[0]);
+        return STATUS_USAGE;
+    }
+
+    u32 entry;
+    if (!load_rom(&g, path, &entry)) {
+        return STATUS_USAGE;
+    }
+
+    gba_reset(&g, entry);
+    const int status = gba_run(&g);
+
+    if (print_cycles) {
+        fprintf(stderr, "agbrun: %llu cycles\n", (unsigned long long) g.cycles);
+    }
+    free(g.rom);
+    return status;
+}
+
+static u32 read32le(const u8* p) {
+    return p[0] | (u32) (p[1] << 8) | ((u32) p[2] << 16) | ((u32) p[3] << 24);
+}
+
+static u16 read16le(const u8* p) {
+    return (u16) (p[0] | (p[1] << 8));
+}
+
+/* Place a loadable segment at its load address, as the cartridge would hold it */
+static int load_segment(struct gba* g, u32 addr, const u8* data, u32 size) {
+    u8* base;
+    u32 limit;
+    switch (addr >> 24) {
+    case 0x2:
+        base = g->ewram;
+        limit = sizeof(g->ewram);
+        addr &= 0x3FFFF;
+        break;
+    case 0x3:
+        base = g->iwram;
+        limit = sizeof(g->iwram);
+        addr &= 0x7FFF;
+        break;
+    case 0x8:
+    case 0x9:
+        base = g->rom;
+        limit = ROM_MAX;
+        addr -= ROM_BASE;
+        if (addr + size > g->rom_size) {
+            g->rom_size = addr + size;
+        }
+        break;
+    default:
+        return 0;
+    }
+    if (addr + size > limit) {
+        return 0;
+    }
+    memcpy(base + addr, data, size);
+    return 1;
+}
+
+static int load_elf(struct gba* g, const u8* file, size_t size, u32* entry) {
+    if (size < 52 || file[4] != 1 || file[5] != 1 || read16le(file + 18) != 40) {
+        fprintf(stderr, "agbrun: not a 32-bit little endian ARM ELF\n");
+        return 0;
+    }
+
+    const u32 phoff = read32le(file + 28);
+    const u16 phentsize = read16le(file + 42);
+    const u16 phnum = read16le(file + 44);
+    *entry = read32le(file + 24);
+
+    for (u32 i = 0; i < phnum; ++i) {
+        const u8* ph = file + phoff + i * phentsize;
+        if (ph + 32 > file + size) {
+            fprintf(stderr, "agbrun: truncated program headers\n");
+            return 0;
+        }
+        if (read32le(ph) != 1 || read32le(ph + 16) == 0) {
+            continue; /* Not PT_LOAD or nothing in the file */
+        }
+        const u32 offset = read32le(ph + 4);
+        const u32 paddr = read32le(ph + 12);
+        const u32 filesz = read32le(ph + 16);
+        if ((size_t) offset + filesz > size || !load_segment(g, paddr, file + offset, filesz)) {
+            fprintf(stderr, "agbrun: cannot load segment at 0x%08x\n", paddr);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int load_rom(struct gba* g, const char* path, u32* entry) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return 0;
+    }
+    fseek(f, 0, SEEK_END);
+    const long length = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (length <= 0) {
+        fprintf(stderr, "agbrun: %s is empty\n", path);
+        fclose(f);
+        return 0;
+    }
+
+    u8* file = malloc((size_t) length);
+    const size_t size = file ? fread(file, 1, (size_t) length, f) : 0;
+    fclose(f);
+    if (size != (size_t) length) {
+        fprintf(stderr, "agbrun: cannot read %s\n", path);
+        free(file);
+        return 0;
+    }
+
+    g->rom = calloc(1, ROM_MAX);
+    g->rom_size = 0;
+    if (!g->rom) {
+        free(file);
+        return 0;
+    }
+
+    int ok;
+    if (size >= 4 && memcmp(file, "\x7f" "ELF", 4) == 0) {
+        ok = load_elf(g, file, size, entry);
+    } else if (size <= ROM_MAX) {
+        memcpy(g->rom, file, size);
+        g->rom_size = (u32) size;
+        *entry = ROM_BASE;
+        ok = 1;
+    } else {
+        fprintf(stderr, "agbrun: %s is larger than 32MiB\n", path);
+        ok = 0;
+    }
+    free(file);
+
+    /* Cartridge data must be readable once loading has placed work RAM segments */
+    if (ok) {
+        g->rom_size = (g->rom_size + 3) & ~3u;
+    }
+    return ok;
+}
+
+void gba_log(struct gba* g, int level, const char* line) {
+    static const char* const prefix[] = {"FATAL: ", "ERROR: ", "WARN: ", "", "DEBUG: "};
+    printf("%s%s\n", level < 5 ? prefix[level] : "", line);
+    fflush(stdout);
+
+    if (strncmp(line, "# exit ", 7) == 0) {
+        g->stopped = 1;
+        g->status = atoi(line + 7);
+    }
+}
+
+static void wait_for_vblank(struct gba* g) {
+    /* Interrupts are never raised, so waiting skips ahead to the next VBlank */
+    const u32 vblank = 160 * CYCLES_PER_LINE;
+    const u32 position = (u32) (g->cycles % CYCLES_PER_FRAME);
+    gba_tick(g, position < vblank ? vblank - position : CYCLES_PER_FRAME - position + vblank);
+}
+
+static void cpu_set(struct gba* g, u32 src, u32 dest, u32 control, int fast) {
+    const int width = (fast || (control & (1u << 26))) ? 4 : 2;
+    const int fill = (control >> 24) & 1;
+    u32 count = control & 0x1FFFFF;
+    if (fast) {
+        count = (count + 7) & ~7u;
+    }
+
+    src &= ~(u32) (width - 1);
+    dest &= ~(u32) (width - 1);
+    const u32 value = bus_read(g, src, width, 0);
+    for (u32 i = 0; i < count; ++i) {
+        bus_write(g, dest, width, fill ? value : bus_read(g, src, width, i != 0), i != 0);
+        dest += (u32) width;
+        if (!fill) {
+            src += (u32) width;
+        }
+    }
+}
+
+void gba_swi(struct gba* g, u32 number) {
+    u32* r = g->cpu.r;
+
+    /* Approximate cost of entering and leaving the BIOS */
+    gba_tick(g, 20);
+
+    switch (number) {
+    case 0x01:
+        if (r[0] & 0x01) {
+            memset(g->ewram, 0, sizeof(g->ewram));
+        }
+        if (r[0] & 0x02) {
+            memset(g->iwram, 0, sizeof(g->iwram) - 0x200);
+        }
+        if (r[0] & 0x04) {
+            memset(g->palette, 0, sizeof(g->palette));
+        }
+        if (r[0] & 0x08) {
+            memset(g->vram, 0, sizeof(g->vram));
+        }
+        if (r[0] & 0x10) {
+            memset(g->oam, 0, sizeof(g->oam));
+        }
+        break;
+    case 0x02: /* Halt */
+    case 0x04: /* IntrWait */
+    case 0x05: /* VBlankIntrWait */
+        wait_for_vblank(g);
+        break;
+    case 0x03: /* Stop */
+        g->stopped = 1;
+        break;
+    case 0x07: { /* DivArm */
+        const u32 tmp = r[0];
+        r[0] = r[1];
+        r[1] = tmp;
+    }
+    /* Fall through */
+    case 0x06: { /* Div */
+        if (r[1] == 0) {
+            gba_fault(g, "division by zero in BIOS call", number);
+            break;
+        }
+        const s32 n = (s32) r[0];
+        const s32 d = (s32) r[1];
+        const s32 q = (n == INT32_MIN && d == -1) ? INT32_MIN : n / d;
+        /* Wrap in u32 so INT32_MIN / -1 gives remainder 0 and abs 0x80000000 */
+        r[1] = r[0] - (u32) q * r[1];
+        r[0] = (u32) q;
+        r[3] = q < 0 ? 0u - (u32) q : (u32) q;
+        gba_tick(g, 100);
+        break;
+    }
+    case 0x08:
+        r[0] = isqrt(r[0]);
+        gba_tick(g, 100);
+        break;
+    case 0x0B:
+        cpu_set(g, r[0], r[1], r[2], 0);
+        break;
+    case 0x0C:
+        cpu_set(g, r[0], r[1], r[2], 1);
+        break;
+    default:
+        gba_fault(g, "unimplemented BIOS call", number);
+        break;
+    }
+}
+
+u32 isqrt(u32 x) {
+    u32 result = 0;
+    u32 bit = 1u << 30;
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (x >= result + bit) {
+            x -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
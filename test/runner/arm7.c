@@ -0,0 +1,981 @@
+/*
+===============================================================================
+
+ ARM7TDMI interpreter for agbrun
+ Cycle counts follow the N/S/I model of the ARM7TDMI technical reference,
+ the GamePak prefetch buffer is not modelled
+
+ Copyright (C) 2021-2023 agbabi contributors
+ For conditions of distribution and use, see copyright notice in LICENSE.md
+
+===============================================================================
+*/
+
+#include "gba.h"
+
+#define SHIFT_LSL (0)
+#define SHIFT_LSR (1)
+#define SHIFT_ASR (2)
+#define SHIFT_ROR (3)
+
+static int bank_index(u32 mode);
+static int condition_passed(u32 cpsr, u32 cond);
+static u32 shift(u32 type, u32 value, u32 amount, int immediate, int* carry);
+static void execute_arm(struct gba* g, u32 op);
+static void execute_thumb(struct gba* g, u16 op);
+
+static inline struct arm7* cpu_of(struct gba* g) {
+    return &g->cpu;
+}
+
+static inline int thumb(const struct arm7* cpu) {
+    return (cpu->cpsr & FLAG_T) != 0;
+}
+
+static inline void idle(struct gba* g, u32 cycles) {
+    gba_tick(g, cycles);
+}
+
+static inline void set_nz(struct arm7* cpu, u32 result) {
+    cpu->cpsr &= ~(FLAG_N | FLAG_Z);
+    cpu->cpsr |= result & FLAG_N;
+    if (result == 0) {
+        cpu->cpsr |= FLAG_Z;
+    }
+}
+
+static inline void set_c(struct arm7* cpu, int carry) {
+    if (carry) {
+        cpu->cpsr |= FLAG_C;
+    } else {
+        cpu->cpsr &= ~FLAG_C;
+    }
+}
+
+static inline void set_v(struct arm7* cpu, int overflow) {
+    if (overflow) {
+        cpu->cpsr |= FLAG_V;
+    } else {
+        cpu->cpsr &= ~FLAG_V;
+    }
+}
+
+static inline u32 carry_in(const struct arm7* cpu) {
+    return (cpu->cpsr >> 29) & 1;
+}
+
+/* a + b + c with flags, subtraction is a + ~b + c */
+static u32 add_with_carry(struct arm7* cpu, u32 a, u32 b, u32 c, int flags) {
+    const u64 wide = (u64) a + b + c;
+    const u32 result = (u32) wide;
+    if (flags) {
+        set_nz(cpu, result);
+        set_c(cpu, (int) (wide >> 32));
+        set_v(cpu, (int) ((~(a ^ b) & (a ^ result)) >> 31));
+    }
+    return result;
+}
+
+static void write_pc(struct gba* g, u32 value) {
+    struct arm7* cpu = cpu_of(g);
+    cpu->pc = value & (thumb(cpu) ? ~1u : ~3u);
+    cpu->refill = 1;
+}
+
+/* Branch and exchange, bit 0 selects Thumb */
+static void write_pc_exchange(struct gba* g, u32 value) {
+    struct arm7* cpu = cpu_of(g);
+    if (value & 1) {
+        cpu->cpsr |= FLAG_T;
+    } else {
+        cpu->cpsr &= ~FLAG_T;
+    }
+    write_pc(g, value);
+}
+
+static void write_reg(struct gba* g, u32 reg, u32 value) {
+    if (reg == 15) {
+        write_pc(g, value);
+    } else {
+        cpu_of(g)->r[reg] = value;
+    }
+}
+
+void arm7_reset(struct gba* g, u32 entry) {
+    struct arm7* cpu = cpu_of(g);
+    for (int i = 0; i < 16; ++i) {
+        cpu->r[i] = 0;
+    }
+    for (int i = 0; i < 6; ++i) {
+        cpu->bank_r13_14[i][0] = 0;
+        cpu->bank_r13_14[i][1] = 0;
+        cpu->bank_spsr[i] = 0;
+    }
+    for (int i = 0; i < 5; ++i) {
+        cpu->bank_r8_12[0][i] = 0;
+        cpu->bank_r8_12[1][i] = 0;
+    }
+
+    /* Stacks as left by the BIOS */
+    cpu->bank_r13_14[bank_index(MODE_SVC)][0] = 0x3007FE0;
+    cpu->bank_r13_14[bank_index(MODE_IRQ)][0] = 0x3007FA0;
+    cpu->r[13] = 0x3007F00;
+    cpu->cpsr = MODE_SYS;
+    cpu->spsr = 0;
+    cpu->pc = entry;
+    cpu->refill = 1;
+}
+
+int bank_index(u32 mode) {
+    switch (mode) {
+    case MODE_FIQ:
+        return 1;
+    case MODE_IRQ:
+        return 2;
+    case MODE_SVC:
+        return 3;
+    case MODE_ABT:
+        return 4;
+    case MODE_UND:
+        return 5;
+    default:
+        return 0;
+    }
+}
+
+void arm7_set_cpsr(struct gba* g, u32 cpsr) {
+    struct arm7* cpu = cpu_of(g);
+    const u32 old_mode = cpu->cpsr & 0x1F;
+    const u32 new_mode = cpsr & 0x1F;
+    if (old_mode != new_mode) {
+        const int old_bank = bank_index(old_mode);
+        const int new_bank = bank_index(new_mode);
+
+        if ((old_mode == MODE_FIQ) != (new_mode == MODE_FIQ)) {
+            for (int i = 0; i < 5; ++i) {
+                cpu->bank_r8_12[old_mode == MODE_FIQ][i] = cpu->r[8 + i];
+                cpu->r[8 + i] = cpu->bank_r8_12[new_mode == MODE_FIQ][i];
+            }
+        }
+
+        if (old_bank != new_bank) {
+            cpu->bank_r13_14[old_bank][0] = cpu->r[13];
+            cpu->bank_r13_14[old_bank][1] = cpu->r[14];
+            cpu->bank_spsr[old_bank] = cpu->spsr;
+            cpu->r[13] = cpu->bank_r13_14[new_bank][0];
+            cpu->r[14] = cpu->bank_r13_14[new_bank][1];
+            cpu->spsr = cpu->bank_spsr[new_bank];
+        }
+    }
+    cpu->cpsr = cpsr;
+}
+
+static u32 read_user_reg(struct gba* g, u32 reg) {
+    struct arm7* cpu = cpu_of(g);
+    const u32 mode = cpu->cpsr & 0x1F;
+    if (reg >= 8 && reg <= 12 && mode == MODE_FIQ) {
+        return cpu->bank_r8_12[0][reg - 8];
+    }
+    if (reg >= 13 && reg <= 14 && bank_index(mode) != 0) {
+        return cpu->bank_r13_14[0][reg - 13];
+    }
+    return cpu->r[reg];
+}
+
+static void write_user_reg(struct gba* g, u32 reg, u32 value) {
+    struct arm7* cpu = cpu_of(g);
+    const u32 mode = cpu->cpsr & 0x1F;
+    if (reg >= 8 && reg <= 12 && mode == MODE_FIQ) {
+        cpu->bank_r8_12[0][reg - 8] = value;
+    } else if (reg >= 13 && reg <= 14 && bank_index(mode) != 0) {
+        cpu->bank_r13_14[0][reg - 13] = value;
+    } else {
+        write_reg(g, reg, value);
+    }
+}
+
+int condition_passed(u32 cpsr, u32 cond) {
+    const int n = (cpsr & FLAG_N) != 0;
+    const int z = (cpsr & FLAG_Z) != 0;
+    const int c = (cpsr & FLAG_C) != 0;
+    const int v = (cpsr & FLAG_V) != 0;
+    switch (cond) {
+    case 0x0: return z;
+    case 0x1: return !z;
+    case 0x2: return c;
+    case 0x3: return !c;
+    case 0x4: return n;
+    case 0x5: return !n;
+    case 0x6: return v;
+    case 0x7: return !v;
+    case 0x8: return c && !z;
+    case 0x9: return !c || z;
+    case 0xA: return n == v;
+    case 0xB: return n != v;
+    case 0xC: return !z && n == v;
+    case 0xD: return z || n != v;
+    case 0xE: return 1;
+    default: return 0;
+    }
+}
+
+u32 shift(u32 type, u32 value, u32 amount, int immediate, int* carry) {
+    switch (type) {
+    case SHIFT_LSL:
+        if (amount == 0) {
+            return value;
+        }
+        if (amount < 32) {
+            *carry = (int) ((value >> (32 - amount)) & 1);
+            return value << amount;
+        }
+        *carry = amount == 32 ? (int) (value & 1) : 0;
+        return 0;
+    case SHIFT_LSR:
+        if (amount == 0) {
+            if (!immediate) {
+                return value;
+            }
+            amount = 32;
+        }
+        if (amount < 32) {
+            *carry = (int) ((value >> (amount - 1)) & 1);
+            return value >> amount;
+        }
+        *carry = amount == 32 ? (int) (value >> 31) : 0;
+        return 0;
+    case SHIFT_ASR:
+        if (amount == 0) {
+            if (!immediate) {
+                return value;
+            }
+            amount = 32;
+        }
+        if (amount < 32) {
+            *carry = (int) ((value >> (amount - 1)) & 1);
+            return (u32) ((s32) value >> amount);
+        }
+        *carry = (int) (value >> 31);
+        return (value & 0x80000000) ? 0xFFFFFFFF : 0;
+    default:
+        if (amount == 0) {
+            if (!immediate) {
+                return value;
+            }
+            /* RRX */
+            const u32 result = ((u32) *carry << 31) | (value >> 1);
+            *carry = (int) (value & 1);
+            return result;
+        }
+        amount &= 31;
+        if (amount == 0) {
+            *carry = (int) (value >> 31);
+            return value;
+        }
+        *carry = (int) ((value >> (amount - 1)) & 1);
+        return (value >> amount) | (value << (32 - amount));
+    }
+}
+
+/* Internal cycles of a multiply by rs */
+static u32 multiply_cycles(u32 rs, int is_signed) {
+    u32 m = 4;
+    if ((rs & 0xFFFFFF00) == 0 || (is_signed && (rs & 0xFFFFFF00) == 0xFFFFFF00)) {
+        m = 1;
+    } else if ((rs & 0xFFFF0000) == 0 || (is_signed && (rs & 0xFFFF0000) == 0xFFFF0000)) {
+        m = 2;
+    } else if ((rs & 0xFF000000) == 0 || (is_signed && (rs & 0xFF000000) == 0xFF000000)) {
+        m = 3;
+    }
+    return m;
+}
+
+/* Unaligned word loads rotate the addressed word */
+static u32 load_word(struct gba* g, u32 addr, int seq) {
+    const u32 value = bus_read(g, addr, 4, seq);
+    const u32 rotate = (addr & 3) * 8;
+    return rotate ? (value >> rotate) | (value << (32 - rotate)) : value;
+}
+
+static u32 load_half(struct gba* g, u32 addr) {
+    const u32 value = bus_read(g, addr, 2, 0);
+    return (addr & 1) ? (value >> 8) | (value << 24) : value;
+}
+
+static u32 load_signed_half(struct gba* g, u32 addr) {
+    if (addr & 1) {
+        return (u32) (s32) (int8_t) bus_read(g, addr, 1, 0);
+    }
+    return (u32) (s32) (int16_t) bus_read(g, addr, 2, 0);
+}
+
+void arm7_step(struct gba* g) {
+    struct arm7* cpu = cpu_of(g);
+    const u32 addr = cpu->pc;
+    const int seq = !cpu->refill;
+
+    cpu->refill = 0;
+
+    if (thumb(cpu)) {
+        const u16 op = (u16) bus_read(g, addr, 2, seq);
+        if (!seq) {
+            /* Pipeline refill fetches the following instruction too */
+            bus_read(g, addr + 2, 2, 1);
+        }
+        cpu->r[15] = addr + 4;
+        cpu->pc = addr + 2;
+        execute_thumb(g, op);
+    } else {
+        const u32 op = bus_read(g, addr, 4, seq);
+        if (!seq) {
+            /* Pipeline refill fetches the following instruction too */
+            bus_read(g, addr + 4, 4, 1);
+        }
+        cpu->r[15] = addr + 8;
+        cpu->pc = addr + 4;
+        if (condition_passed(cpu->cpsr, op >> 28)) {
+            execute_arm(g, op);
+        }
+    }
+}
+
+static void arm_data_processing(struct gba* g, u32 op) {
+    struct arm7* cpu = cpu_of(g);
+    const u32 opcode = (op >> 21) & 0xF;
+    const int set_flags = (op >> 20) & 1;
+    const u32 rn = (op >> 16) & 0xF;
+    const u32 rd = (op >> 12) & 0xF;
+    int carry = (int) carry_in(cpu);
+    u32 operand;
+    u32 a = cpu->r[rn];
+
+    if (op & (1u << 25)) {
+        const u32 imm = op & 0xFF;
+        const u32 rotate = ((op >> 8) & 0xF) * 2;
+        operand = rotate ? (imm >> rotate) | (imm << (32 - rotate)) : imm;
+        if (rotate) {
+            carry = (int) (operand >> 31);
+        }
+    } else {
+        const u32 rm = op & 0xF;
+        const u32 type = (op >> 5) & 3;
+        if (op & (1u << 4)) {
+            /* Register specified shift reads the PC one word further ahead */
+            idle(g, 1);
+            const u32 amount = cpu->r[(op >> 8) & 0xF] & 0xFF;
+            const u32 value = rm == 15 ? cpu->r[15] + 4 : cpu->r[rm];
+            if (rn == 15) {
+                a += 4;
+            }
+            operand = shift(type, value, amount, 0, &carry);
+        } else {
+            operand = shift(type, cpu->r[rm], (op >> 7) & 0x1F, 1, &carry);
+        }
+    }
+
+    const int logical_flags = set_flags && rd != 15;
+    u32 result;
+    switch (opcode) {
+    case 0x0: result = a & operand; break;
+    case 0x1: result = a ^ operand; break;
+    case 0x2: result = add_with_carry(cpu, a, ~operand, 1, logical_flags); break;
+    case 0x3: result = add_with_carry(cpu, operand, ~a, 1, logical_flags); break;
+    case 0x4: result = add_with_carry(cpu, a, operand, 0, logical_flags); break;
+    case 0x5: result = add_with_carry(cpu, a, operand, carry_in(cpu), logical_flags); break;
+    case 0x6: result = add_with_carry(cpu, a, ~operand, carry_in(cpu), logical_flags); break;
+    case 0x7: result = add_with_carry(cpu, operand, ~a, carry_in(cpu), logical_flags); break;
+    case 0x8: result = a & operand; break;
+    case 0x9: result = a ^ operand; break;
+    case 0xA: result = add_with_carry(cpu, a, ~operand, 1, 1); break;
+    case 0xB: result = add_with_carry(cpu, a, operand, 0, 1); break;
+    case 0xC: result = a | operand; break;
+    case 0xD: result = operand; break;
+    case 0xE: result = a & ~operand; break;
+    default: result = ~operand; break;
+    }
+
+    const int is_logical = opcode <= 1 || (opcode >= 0x8 && opcode <= 0x9) || opcode >= 0xC;
+    if (is_logical && (logical_flags || (opcode >= 0x8 && opcode <= 0x9))) {
+        set_nz(cpu, result);
+        set_c(cpu, carry);
+    }
+
+    if (opcode >= 0x8 && opcode <= 0xB) {
+        return; /* TST, TEQ, CMP, CMN */
+    }
+
+    if (rd == 15) {
+        if (set_flags) {
+            arm7_set_cpsr(g, cpu->spsr);
+        }
+        write_pc(g, result);
+    } else {
+        cpu->r[rd] = result;
+    }
+}
+
+static void arm_psr_transfer(struct gba* g, u32 op) {
+    struct arm7* cpu = cpu_of(g);
+    const int use_spsr = (op >> 22) & 1;
+
+    if (!(op & (1u << 21))) {
+        /* MRS */
+        cpu->r[(op >> 12) & 0xF] = use_spsr ? cpu->spsr : cpu->cpsr;
+        return;
+    }
+
+    u32 value;
+    if (op & (1u << 25)) {
+        const u32 imm = op & 0xFF;
+        const u32 rotate = ((op >> 8) & 0xF) * 2;
+        value = rotate ? (imm >> rotate) | (imm << (32 - rotate)) : imm;
+    } else {
+        value = cpu->r[op & 0xF];
+    }
+
+    u32 mask = 0;
+    if (op & (1u << 16)) {
+        mask |= 0x000000FF;
+    }
+    if (op & (1u << 17)) {
+        mask |= 0x0000FF00;
+    }
+    if (op & (1u << 18)) {
+        mask |= 0x00FF0000;
+    }
+    if (op & (1u << 19)) {
+        mask |= 0xFF000000;
+    }
+
+    if (use_spsr) {
+        cpu->spsr = (cpu->spsr & ~mask) | (value & mask);
+        return;
+    }
+
+    if ((cpu->cpsr & 0x1F) == MODE_USR) {
+        mask &= 0xFF000000;
+    }
+    mask &= ~FLAG_T;
+    arm7_set_cpsr(g, (cpu->cpsr & ~mask) | (value & mask));
+}
+
+static void arm_multiply(struct gba* g, u32 op) {
+    struct arm7* cpu = cpu_of(g);
+    const u32 rd = (op >> 16) & 0xF;
+    const u32 rn = (op >> 12) & 0xF;
+    const u32 rs = cpu->r[(op >> 8) & 0xF];
+    const u32 rm = cpu->r[op & 0xF];
+    const int accumulate = (op >> 21) & 1;
+
+    u32 result = rm * rs;
+    if (accumulate) {
+        result += cpu->r[rn];
+    }
+    idle(g, multiply_cycles(rs, 1) + (u32) accumulate);
+    cpu->r[rd] = result;
+    if (op & (1u << 20)) {
+        set_nz(cpu, result);
+    }
+}
+
+static void arm_multiply_long(struct gba* g, u32 op) {
+    struct arm7* cpu = cpu_of(g);
+    const u32 rd_hi = (op >> 16) & 0xF;
+    const u32 rd_lo = (op >> 12) & 0xF;
+    const u32 rs = cpu->r[(op >> 8) & 0xF];
+    const u32 rm = cpu->r[op & 0xF];
+    const int is_signed = (op >> 22) & 1;
+    const int accumulate = (op >> 21) & 1;
+
+    u64 result;
+    if (is_signed) {
+        result = (u64) ((s64) (s32) rm * (s64) (s32) rs);
+    } else {
+        result = (u64) rm * rs;
+    }
+    if (accumulate) {
+        result += ((u64) cpu->r[rd_hi] << 32) | cpu->r[rd_lo];
+    }
+    idle(g, multiply_cycles(rs, is_signed) + 1 + (u32) accumulate);
+    cpu->r[rd_lo] = (u32) result;
+    cpu->r[rd_hi] = (u32) (result >> 32);
+    if (op & (1u << 20)) {
+        cpu->cpsr &= ~(FLAG_N | FLAG_Z);
+        cpu->cpsr |= (u32) (result >> 32) & FLAG_N;
+        if (result == 0) {
+            cpu->cpsr |= FLAG_Z;
+        }
+    }
+}
+
+static void arm_swap(struct gba* g, u32 op) {
+    struct arm7* cpu = cpu_of(g);
+    const u32 addr = cpu->r[(op >> 16) & 0xF];
+    const u32 rm = cpu->r[op & 0xF];
+    const u32 rd = (op >> 12) & 0xF;
+
+    if (op & (1u << 22)) {
+        const u32 value = bus_read(g, addr, 1, 0);
+        bus_write(g, addr, 1, rm, 0);
+        cpu->r[rd] = value;
+    } else {
+        const u32 value = load_word(g, addr, 0);
+        bus_write(g, addr, 4, rm, 0);
+        cpu->r[rd] = value;
+    }
+    idle(g, 1);
+}
+
+static void arm_halfword_transfer(struct gba* g, u32 op) {
+    struct arm7* cpu = cpu_of(g);
+    const int pre = (op >> 24) & 1;
+    const int up = (op >> 23) & 1;
+    const int writeback = (op >> 21) & 1;
+    const int load = (op >> 20) & 1;
+    const u32 rn = (op >> 16) & 0xF;
+    const u32 rd = (op >> 12) & 0xF;
+    const u32 sh = (op >> 5) & 3;
+
+    const u32 offset = (op & (1u << 22)) ? ((op >> 4) & 0xF0) | (op & 0xF) : cpu->r[op & 0xF];
+    const u32 base = cpu->r[rn];
+    const u32 moved = up ? base + offset : base - offset;
+    const u32 addr = pre ? moved : base;
+
+    if (load) {
+        u32 value;
+        if (sh == 1) {
+            value = load_half(g, addr);
+        } else if (sh == 2) {
+            value = (u32) (s32) (int8_t) bus_read(g, addr, 1, 0);
+        } else {
+            value = load_signed_half(g, addr);
+        }
+        idle(g, 1);
+        if (!pre || writeback) {
+            cpu->r[rn] = moved;
+        }
+        write_reg(g, rd, value);
+    } else {
+        const u32 value = rd == 15 ? cpu->r[15] + 4 : cpu->r[rd];
+        bus_write(g, addr, 2, value, 0);
+        if (!pre || writeback) {
+            write_reg(g, rn, moved);
+        }
+    }
+}
+
+static void arm_single_transfer(struct gba* g, u32 op) {
+    struct arm7* cpu = cpu_of(g);
+    const int pre = (op >> 24) & 1;
+    const int up = (op >> 23) & 1;
+    const int byte = (op >> 22) & 1;
+    const int writeback = (op >> 21) & 1;
+    const int load = (op >> 20) & 1;
+    const u32 rn = (op >> 16) & 0xF;
+    const u32 rd = (op >> 12) & 0xF;
+
+    u32 offset;
+    if (op & (1u << 25)) {
+        int carry = (int) carry_in(cpu);
+        offset = shift((op >> 5) & 3, cpu->r[op & 0xF], (op >> 7) & 0x1F, 1, &carry);
+    } else {
+        offset = op & 0xFFF;
+    }
+
+    const u32 base = cpu->r[rn];
+    const u32 moved = up ? base + offset : base - offset;
+    const u32 addr = pre ? moved : base;
+
+    if (load) {
+        const u32 value = byte ? bus_read(g, addr, 1, 0) : load_word(g, addr, 0);
+        idle(g, 1);
+        if (!pre || writeback) {
+            cpu->r[rn] = moved;
+        }
+        write_reg(g, rd, value);
+    } else {
+        const u32 value = rd == 15 ? cpu->r[15] + 4 : cpu->r[rd];
+        bus_write(g, addr, byte ? 1 : 4, value, 0);
+        if (!pre || writeback) {
+            write_reg(g, rn, moved);
+        }
+    }
+}
+
+static void arm_block_transfer(struct gba* g, u32 op) {
+    struct arm7* cpu = cpu_of(g);
+    const int pre = (op >> 24) & 1;
+    const int up = (op >> 23) & 1;
+    const int psr = (op >> 22) & 1;
+    const int writeback = (op >> 21) & 1;
+    const int load = (op >> 20) & 1;
+    const u32 rn = (op >> 16) & 0xF;
+    const u32 list = op & 0xFFFF;
+
+    u32 count = 0;
+    for (u32 i = 0; i < 16; ++i) {
+        count += (list >> i) & 1;
+    }
+
+    const u32 base = cpu->r[rn];
+    const u32 size = count * 4;
+    u32 addr;
+    if (up) {
+        addr = pre ? base + 4 : base;
+    } else {
+        addr = pre ? base - size : base - size + 4;
+    }
+    const u32 final = up ? base + size : base - size;
+    const int user_bank = psr && !(load && (list & 0x8000));
+
+    int seq = 0;
+    if (load) {
+        if (writeback) {
+            cpu->r[rn] = final;
+        }
+        for (u32 i = 0; i < 16; ++i) {
+            if (!(list & (1u << i))) {
+                continue;
+            }
+            const u32 value = bus_read(g, addr, 4, seq);
+            if (user_bank) {
+                write_user_reg(g, i, value);
+            } else if (i == 15 && psr) {
+                /* Return from exception, restore the state before aligning the PC */
+                arm7_set_cpsr(g, cpu->spsr);
+                write_pc(g, value);
+            } else {
+                write_reg(g, i, value);
+            }
+            addr += 4;
+            seq = 1;
+        }
+        idle(g, 1);
+    } else {
+        int first = 1;
+        for (u32 i = 0; i < 16; ++i) {
+            if (!(list & (1u << i))) {
+                continue;
+            }
+            u32 value;
+            if (i == 15) {
+                value = cpu->r[15] + 4;
+            } else if (i == rn && !first && writeback) {
+                value = final;
+            } else {
+                value = user_bank ? read_user_reg(g, i) : cpu->r[i];
+            }
+            bus_write(g, addr, 4, value, seq);
+            addr += 4;
+            seq = 1;
+            first = 0;
+        }
+        if (writeback) {
+            cpu->r[rn] = final;
+        }
+    }
+}
+
+void execute_arm(struct gba* g, u32 op) {
+    struct arm7* cpu = cpu_of(g);
+
+    if ((op & 0x0FFFFFF0) == 0x012FFF10) {
+        write_pc_exchange(g, cpu->r[op & 0xF]);
+    } else if ((op & 0x0FC000F0) == 0x00000090) {
+        arm_multiply(g, op);
+    } else if ((op & 0x0F8000F0) == 0x00800090) {
+        arm_multiply_long(g, op);
+    } else if ((op & 0x0FB00FF0) == 0x01000090) {
+        arm_swap(g, op);
+    } else if ((op & 0x0E000090) == 0x00000090 && (op & 0x60) != 0) {
+        arm_halfword_transfer(g, op);
+    } else if ((op & 0x0FB00000) == 0x01000000 || (op & 0x0DB00000) == 0x01200000) {
+        arm_psr_transfer(g, op);
+    } else if ((op & 0x0C000000) == 0x00000000) {
+        arm_data_processing(g, op);
+    } else if ((op & 0x0E000010) == 0x06000010) {
+        gba_fault(g, "undefined instruction", op);
+    } else if ((op & 0x0C000000) == 0x04000000) {
+        arm_single_transfer(g, op);
+    } else if ((op & 0x0E000000) == 0x08000000) {
+        arm_block_transfer(g, op);
+    } else if ((op & 0x0E000000) == 0x0A000000) {
+        if (op & (1u << 24)) {
+            cpu->r[14] = cpu->pc;
+        }
+        write_pc(g, cpu->r[15] + (u32) ((s32) (op << 8) >> 6));
+    } else if ((op & 0x0F000000) == 0x0F000000) {
+        gba_swi(g, (op >> 16) & 0xFF);
+    } else {
+        gba_fault(g, "undefined instruction", op);
+    }
+}
+
+static u32 thumb_alu(struct gba* g, u32 opcode, u32 a, u32 b) {
+    struct arm7* cpu = cpu_of(g);
+    int carry = (int) carry_in(cpu);
+    u32 result;
+
+    switch (opcode) {
+    case 0x0: result = a & b; break;
+    case 0x1: result = a ^ b; break;
+    case 0x2: idle(g, 1); result = shift(SHIFT_LSL, a, b & 0xFF, 0, &carry); set_c(cpu, carry); break;
+    case 0x3: idle(g, 1); result = shift(SHIFT_LSR, a, b & 0xFF, 0, &carry); set_c(cpu, carry); break;
+    case 0x4: idle(g, 1); result = shift(SHIFT_ASR, a, b & 0xFF, 0, &carry); set_c(cpu, carry); break;
+    case 0x5: return add_with_carry(cpu, a, b, carry_in(cpu), 1);
+    case 0x6: return add_with_carry(cpu, a, ~b, carry_in(cpu), 1);
+    case 0x7: idle(g, 1); result = shift(SHIFT_ROR, a, b & 0xFF, 0, &carry); set_c(cpu, carry); break;
+    case 0x8: result = a & b; break;
+    case 0x9: return add_with_carry(cpu, 0, ~b, 1, 1);
+    case 0xA: return add_with_carry(cpu, a, ~b, 1, 1);
+    case 0xB: return add_with_carry(cpu, a, b, 0, 1);
+    case 0xC: result = a | b; break;
+    case 0xD: idle(g, multiply_cycles(a, 1)); result = a * b; break;
+    case 0xE: result = a & ~b; break;
+    default: result = ~b; break;
+    }
+    set_nz(cpu, result);
+    return result;
+}
+
+void execute_thumb(struct gba* g, u16 op) {
+    struct arm7* cpu = cpu_of(g);
+    u32* r = cpu->r;
+
+    switch (op >> 13) {
+    case 0x0:
+        if ((op & 0x1800) == 0x1800) {
+            /* Add/subtract register or 3-bit immediate */
+            const u32 operand = (op & 0x400) ? (u32) ((op >> 6) & 7) : r[(op >> 6) & 7];
+            const u32 a = r[(op >> 3) & 7];
+            if (op & 0x200) {
+                r[op & 7] = add_with_carry(cpu, a, ~operand, 1, 1);
+            } else {
+                r[op & 7] = add_with_carry(cpu, a, operand, 0, 1);
+            }
+        } else {
+            /* Shift by immediate */
+            int carry = (int) carry_in(cpu);
+            const u32 result = shift((op >> 11) & 3, r[(op >> 3) & 7], (op >> 6) & 0x1F, 1, &carry);
+            set_c(cpu, carry);
+            set_nz(cpu, result);
+            r[op & 7] = result;
+        }
+        return;
+    case 0x1: {
+        /* MOV/CMP/ADD/SUB 8-bit immediate */
+        const u32 rd = (op >> 8) & 7;
+        const u32 imm = op & 0xFF;
+        switch ((op >> 11) & 3) {
+        case 0: r[rd] = imm; set_nz(cpu, imm); break;
+        case 1: add_with_carry(cpu, r[rd], ~imm, 1, 1); break;
+        case 2: r[rd] = add_with_carry(cpu, r[rd], imm, 0, 1); break;
+        default: r[rd] = add_with_carry(cpu, r[rd], ~imm, 1, 1); break;
+        }
+        return;
+    }
+    case 0x2:
+        if ((op & 0xFC00) == 0x4000) {
+            /* ALU operations */
+            const u32 rd = op & 7;
+            const u32 opcode = (op >> 6) & 0xF;
+            const u32 result = thumb_alu(g, opcode, r[rd], r[(op >> 3) & 7]);
+            if (opcode != 0x8 && opcode != 0xA && opcode != 0xB) {
+                r[rd] = result;
+            }
+        } else if ((op & 0xFC00) == 0x4400) {
+            /* Hi register operations and BX */
+            const u32 rd = (op & 7) | ((op >> 4) & 8);
+            const u32 rs = (op >> 3) & 0xF;
+            switch ((op >> 8) & 3) {
+            case 0: write_reg(g, rd, r[rd] + r[rs]); break;
+            case 1: add_with_carry(cpu, r[rd], ~r[rs], 1, 1); break;
+            case 2: write_reg(g, rd, r[rs]); break;
+            default: write_pc_exchange(g, r[rs]); break;
+            }
+        } else if ((op & 0xF800) == 0x4800) {
+            /* PC relative load */
+            r[(op >> 8) & 7] = bus_read(g, (r[15] & ~3u) + (u32) (op & 0xFF) * 4, 4, 0);
+            idle(g, 1);
+        } else {
+            /* Load/store with register offset */
+            const u32 addr = r[(op >> 3) & 7] + r[(op >> 6) & 7];
+            const u32 rd = op & 7;
+            switch ((op >> 9) & 7) {
+            case 0: bus_write(g, addr, 4, r[rd], 0); break;
+            case 1: bus_write(g, addr, 2, r[rd], 0); break;
+            case 2: bus_write(g, addr, 1, r[rd], 0); break;
+            case 3: r[rd] = (u32) (s32) (int8_t) bus_read(g, addr, 1, 0); idle(g, 1); break;
+            case 4: r[rd] = load_word(g, addr, 0); idle(g, 1); break;
+            case 5: r[rd] = load_half(g, addr); idle(g, 1); break;
+            case 6: r[rd] = bus_read(g, addr, 1, 0); idle(g, 1); break;
+            default: r[rd] = load_signed_half(g, addr); idle(g, 1); break;
+            }
+        }
+        return;
+    case 0x3: {
+        /* Load/store with immediate offset */
+        const u32 rd = op & 7;
+        const u32 base = r[(op >> 3) & 7];
+        const u32 offset = (op >> 6) & 0x1F;
+        if (op & 0x1000) {
+            if (op & 0x800) {
+                r[rd] = bus_read(g, base + offset, 1, 0);
+                idle(g, 1);
+            } else {
+                bus_write(g, base + offset, 1, r[rd], 0);
+            }
+        } else if (op & 0x800) {
+            r[rd] = load_word(g, base + offset * 4, 0);
+            idle(g, 1);
+        } else {
+            bus_write(g, base + offset * 4, 4, r[rd], 0);
+        }
+        return;
+    }
+    case 0x4: {
+        const u32 rd = (op >> 8) & 7;
+        if (op & 0x1000) {
+            /* SP relative load/store */
+            const u32 addr = r[13] + (u32) (op & 0xFF) * 4;
+            if (op & 0x800) {
+                r[rd] = load_word(g, addr, 0);
+                idle(g, 1);
+            } else {
+                bus_write(g, addr, 4, r[rd], 0);
+            }
+        } else {
+            /* Load/store halfword */
+            const u32 addr = r[(op >> 3) & 7] + ((op >> 6) & 0x1F) * 2u;
+            if (op & 0x800) {
+                r[op & 7] = load_half(g, addr);
+                idle(g, 1);
+            } else {
+                bus_write(g, addr, 2, r[op & 7], 0);
+            }
+        }
+        return;
+    }
+    case 0x5:
+        if (!(op & 0x1000)) {
+            /* Load address */
+            const u32 base = (op & 0x800) ? r[13] : (r[15] & ~3u);
+            r[(op >> 8) & 7] = base + (u32) (op & 0xFF) * 4;
+        } else if ((op & 0xFF00) == 0xB000) {
+            /* Add offset to SP */
+            const u32 offset = (u32) (op & 0x7F) * 4;
+            r[13] = (op & 0x80) ? r[13] - offset : r[13] + offset;
+        } else if ((op & 0xF600) == 0xB400) {
+            /* PUSH/POP */
+            const u32 list = op & 0xFF;
+            const int extra = (op >> 8) & 1;
+            u32 count = (u32) extra;
+            for (u32 i = 0; i < 8; ++i) {
+                count += (list >> i) & 1;
+            }
+            int seq = 0;
+            if (op & 0x800) {
+                u32 addr = r[13];
+                for (u32 i = 0; i < 8; ++i) {
+                    if (list & (1u << i)) {
+                        r[i] = bus_read(g, addr, 4, seq);
+                        addr += 4;
+                        seq = 1;
+                    }
+                }
+                if (extra) {
+                    write_pc(g, bus_read(g, addr, 4, seq));
+                    addr += 4;
+                }
+                r[13] = addr;
+                idle(g, 1);
+            } else {
+                u32 addr = r[13] - count * 4;
+                r[13] = addr;
+                for (u32 i = 0; i < 8; ++i) {
+                    if (list & (1u << i)) {
+                        bus_write(g, addr, 4, r[i], seq);
+                        addr += 4;
+                        seq = 1;
+                    }
+                }
+                if (extra) {
+                    bus_write(g, addr, 4, r[14], seq);
+                }
+            }
+        } else {
+            gba_fault(g, "undefined thumb instruction", op);
+        }
+        return;
+    case 0x6:
+        if (!(op & 0x1000)) {
+            /* LDMIA/STMIA */
+            const u32 rb = (op >> 8) & 7;
+            const u32 list = op & 0xFF;
+            u32 addr = r[rb];
+            int seq = 0;
+            if (op & 0x800) {
+                for (u32 i = 0; i < 8; ++i) {
+                    if (list & (1u << i)) {
+                        r[i] = bus_read(g, addr, 4, seq);
+                        addr += 4;
+                        seq = 1;
+                    }
+                }
+                if (!(list & (1u << rb))) {
+                    r[rb] = addr;
+                }
+                idle(g, 1);
+            } else {
+                const u32 start = addr;
+                u32 count = 0;
+                for (u32 i = 0; i < 8; ++i) {
+                    count += (list >> i) & 1;
+                }
+                int first = 1;
+                for (u32 i = 0; i < 8; ++i) {
+                    if (list & (1u << i)) {
+                        const u32 value = (i == rb && !first) ? start + count * 4 : r[i];
+                        bus_write(g, addr, 4, value, seq);
+                        addr += 4;
+                        seq = 1;
+                        first = 0;
+                    }
+                }
+                r[rb] = addr;
+            }
+        } else if ((op & 0xFF00) == 0xDF00) {
+            gba_swi(g, op & 0xFF);
+        } else if ((op & 0x0F00) != 0x0E00) {
+            /* Conditional branch */
+            if (condition_passed(cpu->cpsr, (op >> 8) & 0xF)) {
+                write_pc(g, r[15] + (u32) ((s32) (int8_t) (op & 0xFF) * 2));
+            }
+        } else {
+            gba_fault(g, "undefined thumb instruction", op);
+        }
+        return;
+    default:
+        switch ((op >> 11) & 3) {
+        case 0:
+            /* Unconditional branch */
+            write_pc(g, r[15] + (u32) (((s32) ((u32) op << 21) >> 21) * 2));
+            break;
+        case 2:
+            /* BL high half */
+            r[14] = r[15] + (u32) (((s32) ((u32) op << 21) >> 21) << 12);
+            break;
+        case 3: {
+            /* BL low half */
+            const u32 next = cpu->pc;
+            write_pc(g, r[14] + (u32) (op & 0x7FF) * 2);
+            r[14] = next | 1;
+            break;
+        }
+        default:
+            gba_fault(g, "undefined thumb instruction", op);
+            break;
+        }
+        return;
+    }
+}
@@ -0,0 +1,403 @@
+/*
+===============================================================================
+
+ Memory map, waitstates, timers and DMA for agbrun
+
+ Copyright (C) 2021-2023 agbabi contributors
+ For conditions of distribution and use, see copyright notice in LICENSE.md
+
+===============================================================================
+*/
+
+#include "gba.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define REG_DISPCNT (0x000)
+#define REG_DISPSTAT (0x004)
+#define REG_VCOUNT (0x006)
+#define REG_DMA0SAD (0x0B0)
+#define REG_DMA3CNT_H (0x0DE)
+#define REG_TM0D (0x100)
+#define REG_TM3CNT (0x10E)
+#define REG_KEYINPUT (0x130)
+#define REG_WAITCNT (0x204)
+
+#define DEBUG_STRING (0xFFF600)
+#define DEBUG_FLAGS (0xFFF700)
+#define DEBUG_ENABLE (0xFFF780)
+
+static const u32 timer_prescale[4] = {1, 64, 256, 1024};
+static const u32 rom_wait_n[4] = {4, 3, 2, 8};
+static const u32 rom_wait_s[3][2] = {{2, 1}, {4, 1}, {8, 1}};
+
+static u16 io_read16(struct gba* g, u32 reg);
+static void io_write16(struct gba* g, u32 reg, u16 value);
+static void dma_run(struct gba* g, int channel);
+
+static inline u16 load16(const u8* p) {
+    return (u16) (p[0] | (p[1] << 8));
+}
+
+static inline void store16(u8* p, u32 value) {
+    p[0] = (u8) value;
+    p[1] = (u8) (value >> 8);
+}
+
+/* Work RAM is left as loaded, ELF segments may target it */
+void gba_reset(struct gba* g, u32 entry) {
+    memset(g->io, 0, sizeof(g->io));
+    memset(g->palette, 0, sizeof(g->palette));
+    memset(g->vram, 0, sizeof(g->vram));
+    memset(g->oam, 0, sizeof(g->oam));
+    memset(g->sram, 0xff, sizeof(g->sram));
+    memset(g->timers, 0, sizeof(g->timers));
+    memset(g->dmas, 0, sizeof(g->dmas));
+    memset(g->log, 0, sizeof(g->log));
+    g->log_enabled = 0;
+    g->cycles = 0;
+    g->stopped = 0;
+    g->status = 0;
+    arm7_reset(g, entry);
+}
+
+int gba_run(struct gba* g) {
+    while (!g->stopped) {
+        if (g->max_cycles && g->cycles >= g->max_cycles) {
+            fprintf(stderr, "agbrun: timed out after %llu cycles\n", (unsigned long long) g->cycles);
+            return STATUS_TIMEOUT;
+        }
+        arm7_step(g);
+    }
+    return g->status;
+}
+
+void gba_fault(struct gba* g, const char* message, u32 value) {
+    fprintf(stderr, "agbrun: %s 0x%08x (pc 0x%08x)\n", message, value, g->cpu.r[15]);
+    g->stopped = 1;
+    g->status = STATUS_FAULT;
+}
+
+void gba_tick(struct gba* g, u32 cycles) {
+    g->cycles += cycles;
+
+    u32 overflows = 0;
+    for (int i = 0; i < 4; ++i) {
+        struct timer* t = &g->timers[i];
+        if (!(t->control & 0x80)) {
+            overflows = 0;
+            continue;
+        }
+
+        u32 increments;
+        if (i > 0 && (t->control & 0x4)) {
+            increments = overflows;
+        } else {
+            t->ticks += cycles;
+            increments = t->ticks / timer_prescale[t->control & 3];
+            t->ticks %= timer_prescale[t->control & 3];
+        }
+
+        overflows = 0;
+        while (increments) {
+            const u32 room = 0x10000 - t->counter;
+            if (increments < room) {
+                t->counter += increments;
+                break;
+            }
+            increments -= room;
+            t->counter = t->reload;
+            ++overflows;
+        }
+    }
+}
+
+/* Waitstates for a single access, 32-bit accesses to 16-bit buses are two accesses */
+static u32 access_cycles(struct gba* g, u32 addr, int width, int seq) {
+    switch (addr >> 24) {
+    case 0x2:
+        return width == 4 ? 6 : 3;
+    case 0x5:
+    case 0x6:
+        return width == 4 ? 2 : 1;
+    case 0x8: case 0x9:
+    case 0xA: case 0xB:
+    case 0xC: case 0xD: {
+        const u32 waitcnt = load16(&g->io[REG_WAITCNT]);
+        const int ws = (int) ((addr >> 25) & 3);
+        const u32 n = rom_wait_n[(waitcnt >> (2 + ws * 3)) & 3] + 1;
+        const u32 s = rom_wait_s[ws][(waitcnt >> (4 + ws * 3)) & 1] + 1;
+        const u32 first = seq ? s : n;
+        return width == 4 ? first + s : first;
+    }
+    case 0xE:
+    case 0xF:
+        return rom_wait_n[load16(&g->io[REG_WAITCNT]) & 3] + 1;
+    default:
+        return 1;
+    }
+}
+
+static u32 vram_offset(u32 addr) {
+    u32 offset = addr & 0x1FFFF;
+    if (offset >= 0x18000) {
+        offset -= 0x8000;
+    }
+    return offset;
+}
+
+static u32 read_rom(const struct gba* g, u32 addr, int width) {
+    const u32 offset = addr & 0x1FFFFFF;
+    if (offset + (u32) width > g->rom_size) {
+        /* Open bus returns the address bus halfwords */
+        const u32 lo = (offset >> 1) & 0xFFFF;
+        return lo | ((lo + 1) << 16);
+    }
+    const u8* p = g->rom + offset;
+    return p[0] | (u32) (p[1] << 8) | ((u32) p[2] << 16) | ((u32) p[3] << 24);
+}
+
+static u32 read_bytes(const u8* p) {
+    return p[0] | (u32) (p[1] << 8) | ((u32) p[2] << 16) | ((u32) p[3] << 24);
+}
+
+u32 bus_read(struct gba* g, u32 addr, int width, int seq) {
+    gba_tick(g, access_cycles(g, addr, width, seq));
+
+    addr &= ~(u32) (width - 1);
+    u32 value;
+    switch (addr >> 24) {
+    case 0x2:
+        value = read_bytes(&g->ewram[addr & 0x3FFFC]) >> ((addr & 3) * 8);
+        break;
+    case 0x3:
+        value = read_bytes(&g->iwram[addr & 0x7FFC]) >> ((addr & 3) * 8);
+        break;
+    case 0x4: {
+        const u32 offset = addr & 0xFFFFFF;
+        if (offset < sizeof(g->io)) {
+            value = io_read16(g, offset & ~3u) | ((u32) io_read16(g, (offset & ~3u) + 2) << 16);
+            value >>= (offset & 3) * 8;
+        } else if (offset == DEBUG_ENABLE) {
+            value = g->log_enabled ? 0x1DEA : 0;
+        } else {
+            value = 0;
+        }
+        break;
+    }
+    case 0x5:
+        value = read_bytes(&g->palette[addr & 0x3FC]) >> ((addr & 3) * 8);
+        break;
+    case 0x6:
+        value = read_bytes(&g->vram[vram_offset(addr) & ~3u]) >> ((addr & 3) * 8);
+        break;
+    case 0x7:
+        value = read_bytes(&g->oam[addr & 0x3FC]) >> ((addr & 3) * 8);
+        break;
+    case 0x8: case 0x9:
+    case 0xA: case 0xB:
+    case 0xC: case 0xD:
+        value = read_rom(g, addr & ~3u, 4) >> ((addr & 3) * 8);
+        break;
+    case 0xE:
+    case 0xF:
+        /* 8-bit bus, wider reads repeat the byte */
+        value = g->sram[addr & 0xFFFF] * 0x01010101u;
+        break;
+    default:
+        value = 0;
+        break;
+    }
+
+    if (width == 1) {
+        return value & 0xFF;
+    }
+    if (width == 2) {
+        return value & 0xFFFF;
+    }
+    return value;
+}
+
+static void write_bytes(u8* p, int width, u32 value) {
+    for (int i = 0; i < width; ++i) {
+        p[i] = (u8) (value >> (i * 8));
+    }
+}
+
+static void write_io(struct gba* g, u32 offset, int width, u32 value) {
+    if (offset >= DEBUG_STRING && offset < DEBUG_STRING + 0x100) {
+        write_bytes((u8*) &g->log[offset - DEBUG_STRING], width, value);
+        return;
+    }
+    if (offset == DEBUG_FLAGS) {
+        if (value & 0x100) {
+            gba_log(g, (int) (value & 7), g->log);
+            memset(g->log, 0, sizeof(g->log));
+        }
+        return;
+    }
+    if (offset == DEBUG_ENABLE) {
+        g->log_enabled = (value & 0xFFFF) == 0xC0DE;
+        return;
+    }
+    if (offset >= sizeof(g->io)) {
+        return;
+    }
+
+    if (width == 1) {
+        const u32 reg = offset & ~1u;
+        u32 half = load16(&g->io[reg]);
+        if (offset & 1) {
+            half = (half & 0x00FF) | ((value & 0xFF) << 8);
+        } else {
+            half = (half & 0xFF00) | (value & 0xFF);
+        }
+        io_write16(g, reg, (u16) half);
+    } else if (width == 2) {
+        io_write16(g, offset, (u16) value);
+    } else {
+        io_write16(g, offset, (u16) value);
+        io_write16(g, offset + 2, (u16) (value >> 16));
+    }
+}
+
+void bus_write(struct gba* g, u32 addr, int width, u32 value, int seq) {
+    gba_tick(g, access_cycles(g, addr, width, seq));
+
+    addr &= ~(u32) (width - 1);
+    switch (addr >> 24) {
+    case 0x2:
+        write_bytes(&g->ewram[addr & 0x3FFFF], width, value);
+        break;
+    case 0x3:
+        write_bytes(&g->iwram[addr & 0x7FFF], width, value);
+        break;
+    case 0x4:
+        write_io(g, addr & 0xFFFFFF, width, value);
+        break;
+    case 0x5:
+        if (width == 1) {
+            /* Byte stores to video memory write the byte to both halves */
+            store16(&g->palette[addr & 0x3FE], (value & 0xFF) * 0x0101u);
+        } else {
+            write_bytes(&g->palette[addr & 0x3FF], width, value);
+        }
+        break;
+    case 0x6: {
+        const u32 offset = vram_offset(addr);
+        if (width == 1) {
+            /* Byte stores to OBJ tiles are ignored */
+            const u32 obj_base = (g->io[REG_DISPCNT] & 7) >= 3 ? 0x14000 : 0x10000;
+            if (offset < obj_base) {
+                store16(&g->vram[offset & ~1u], (value & 0xFF) * 0x0101u);
+            }
+        } else {
+            write_bytes(&g->vram[offset], width, value);
+        }
+        break;
+    }
+    case 0x7:
+        if (width != 1) {
+            write_bytes(&g->oam[addr & 0x3FF], width, value);
+        }
+        break;
+    case 0xE:
+    case 0xF:
+        g->sram[addr & 0xFFFF] = (u8) (value >> ((addr & 3) * 8));
+        break;
+    default:
+        break;
+    }
+}
+
+u16 io_read16(struct gba* g, u32 reg) {
+    if (reg >= REG_TM0D && reg <= REG_TM3CNT) {
+        const struct timer* t = &g->timers[(reg - REG_TM0D) / 4];
+        return (reg & 2) ? t->control : (u16) t->counter;
+    }
+
+    switch (reg) {
+    case REG_DISPSTAT: {
+        const u32 line = (u32) (g->cycles / CYCLES_PER_LINE) % 228;
+        const u32 dot = (u32) (g->cycles % CYCLES_PER_LINE);
+        u16 value = load16(&g->io[REG_DISPSTAT]) & 0xFFF8;
+        if (line >= 160 && line < 227) {
+            value |= 1;
+        }
+        if (dot >= 1006) {
+            value |= 2;
+        }
+        if (line == (u32) (value >> 8)) {
+            value |= 4;
+        }
+        return value;
+    }
+    case REG_VCOUNT:
+        return (u16) ((g->cycles / CYCLES_PER_LINE) % 228);
+    case REG_KEYINPUT:
+        return 0x3FF; /* No keys held */
+    default:
+        return load16(&g->io[reg]);
+    }
+}
+
+void io_write16(struct gba* g, u32 reg, u16 value) {
+    if (reg >= REG_TM0D && reg <= REG_TM3CNT) {
+        struct timer* t = &g->timers[(reg - REG_TM0D) / 4];
+        if (reg & 2) {
+            if (!(t->control & 0x80) && (value & 0x80)) {
+                t->counter = t->reload;
+                t->ticks = 0;
+            }
+            t->control = value;
+        } else {
+            t->reload = value;
+        }
+        return;
+    }
+
+    const u16 previous = load16(&g->io[reg]);
+    store16(&g->io[reg], value);
+
+    if (reg >= REG_DMA0SAD && reg <= REG_DMA3CNT_H && (reg - REG_DMA0SAD) % 12 == 10) {
+        const int channel = (int) (reg - REG_DMA0SAD) / 12;
+        if (!(previous & 0x8000) && (value & 0x8000)) {
+            const u8* regs = &g->io[REG_DMA0SAD + channel * 12];
+            struct dma* d = &g->dmas[channel];
+            d->src = read_bytes(regs) & (channel == 0 ? 0x07FFFFFF : 0x0FFFFFFF);
+            d->dest = read_bytes(regs + 4) & (channel == 3 ? 0x0FFFFFFF : 0x07FFFFFF);
+            d->count = load16(regs + 8);
+            if (d->count == 0) {
+                d->count = channel == 3 ? 0x10000 : 0x4000;
+            }
+            /* Only immediate transfers start by themselves, interrupts are never raised */
+            if (((value >> 12) & 3) == 0) {
+                dma_run(g, channel);
+            }
+        }
+    }
+}
+
+void dma_run(struct gba* g, int channel) {
+    struct dma* d = &g->dmas[channel];
+    const u32 reg = REG_DMA0SAD + (u32) channel * 12 + 10;
+    const u16 control = load16(&g->io[reg]);
+    const int width = (control & 0x400) ? 4 : 2;
+    const int dest_step[4] = {width, -width, 0, width};
+    const int src_step[4] = {width, -width, 0, 0};
+
+    u32 src = d->src & ~(u32) (width - 1);
+    u32 dest = d->dest & ~(u32) (width - 1);
+    gba_tick(g, 2);
+    for (u32 i = 0; i < d->count; ++i) {
+        const u32 value = bus_read(g, src, width, i != 0);
+        bus_write(g, dest, width, value, i != 0);
+        src += (u32) src_step[(control >> 7) & 3];
+        dest += (u32) dest_step[(control >> 5) & 3];
+    }
+    d->src = src;
+    d->dest = dest;
+
+    store16(&g->io[reg], control & 0x7FFF);
+}
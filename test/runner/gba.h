@@ -0,0 +1,112 @@
+/*
+===============================================================================
+
+ Headless GBA machine state for agbrun
+
+ Copyright (C) 2021-2023 agbabi contributors
+ For conditions of distribution and use, see copyright notice in LICENSE.md
+
+===============================================================================
+*/
+
+#ifndef AGBRUN_GBA_H
+#define AGBRUN_GBA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int32_t s32;
+typedef int64_t s64;
+
+#define MODE_USR (0x10)
+#define MODE_FIQ (0x11)
+#define MODE_IRQ (0x12)
+#define MODE_SVC (0x13)
+#define MODE_ABT (0x17)
+#define MODE_UND (0x1B)
+#define MODE_SYS (0x1F)
+
+#define FLAG_N (1u << 31)
+#define FLAG_Z (1u << 30)
+#define FLAG_C (1u << 29)
+#define FLAG_V (1u << 28)
+#define FLAG_T (1u << 5)
+
+#define CYCLES_PER_LINE (1232u)
+#define CYCLES_PER_FRAME (CYCLES_PER_LINE * 228u)
+
+/* Exit status when the run does not finish by itself */
+#define STATUS_TIMEOUT (124)
+#define STATUS_FAULT (125)
+
+struct arm7 {
+    u32 r[16];
+    u32 pc; /* Address of the next instruction, r[15] holds the pipelined value */
+    u32 cpsr;
+    u32 spsr;
+    u32 bank_r8_12[2][5]; /* [0] = every mode but FIQ, [1] = FIQ */
+    u32 bank_r13_14[6][2];
+    u32 bank_spsr[6];
+    int refill; /* Next fetch is non-sequential */
+};
+
+struct timer {
+    u16 reload;
+    u16 control;
+    u32 counter;
+    u32 ticks;
+};
+
+struct dma {
+    u32 src;
+    u32 dest;
+    u32 count;
+};
+
+struct gba {
+    struct arm7 cpu;
+
+    u8* rom;
+    u32 rom_size;
+
+    u8 ewram[0x40000];
+    u8 iwram[0x8000];
+    u8 io[0x400];
+    u8 palette[0x400];
+    u8 vram[0x18000];
+    u8 oam[0x400];
+    u8 sram[0x10000];
+
+    struct timer timers[4];
+    struct dma dmas[4];
+
+    char log[0x101];
+    int log_enabled;
+
+    u64 cycles;
+    u64 max_cycles;
+    int stopped;
+    int status;
+};
+
+void gba_reset(struct gba* g, u32 entry);
+int gba_run(struct gba* g);
+void gba_tick(struct gba* g, u32 cycles);
+void gba_fault(struct gba* g, const char* message, u32 value);
+
+u32 bus_read(struct gba* g, u32 addr, int width, int seq);
+void bus_write(struct gba* g, u32 addr, int width, u32 value, int seq);
+
+void arm7_reset(struct gba* g, u32 entry);
+void arm7_step(struct gba* g);
+void arm7_set_cpsr(struct gba* g, u32 cpsr);
+
+/* Implemented by the front end */
+void gba_swi(struct gba* g, u32 number);
+void gba_log(struct gba* g, int level, const char* line);
+
+#endif /* define AGBRUN_GBA_H */
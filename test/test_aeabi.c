@@ -0,0 +1,247 @@
+#include <aeabi.h>
+
+#include "agbtest.h"
+
+AGBTEST(aeabi, lcmp) {
+    ASSERT_EQUAL(__aeabi_lcmp(0, 0), 0);
+    ASSERT_EQUAL(__aeabi_lcmp(-1, 0), -1);
+    ASSERT_EQUAL(__aeabi_lcmp(0, -1), 1);
+    ASSERT_EQUAL(__aeabi_lcmp(0x100000000ll, 0xffffffffll), 1);
+    ASSERT_EQUAL(__aeabi_lcmp(0xffffffffll, 0x100000000ll), -1);
+    ASSERT_EQUAL(__aeabi_lcmp(-0x7fffffffffffffffll - 1, 0x7fffffffffffffffll), -1);
+    ASSERT_EQUAL(__aeabi_lcmp(0x7fffffffffffffffll, 0x7fffffffffffffffll), 0);
+}
+
+AGBTEST(aeabi, ulcmp) {
+    ASSERT_EQUAL(__aeabi_ulcmp(0, 0), 0);
+    ASSERT_EQUAL(__aeabi_ulcmp(0xffffffffffffffffull, 0), 1);
+    ASSERT_EQUAL(__aeabi_ulcmp(0, 0xffffffffffffffffull), -1);
+    ASSERT_EQUAL(__aeabi_ulcmp(0x100000000ull, 0xffffffffull), 1);
+    ASSERT_EQUAL(__aeabi_ulcmp(0x8000000000000000ull, 0x7fffffffffffffffull), 1);
+    ASSERT_EQUAL(__aeabi_ulcmp(0x123456789ull, 0x123456789ull), 0);
+}
+
+AGBTEST(aeabi, uread) {
+    static const unsigned char bytes[] __attribute__((aligned(4))) = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb};
+    ASSERT_EQUAL(__aeabi_uread4((void*) bytes), 0x33221100);
+    ASSERT_EQUAL(__aeabi_uread4((void*) (bytes + 1)), 0x44332211);
+    ASSERT_EQUAL(__aeabi_uread4((void*) (bytes + 2)), 0x55443322);
+    ASSERT_EQUAL(__aeabi_uread4((void*) (bytes + 3)), 0x66554433);
+    ASSERT_EQUAL(__aeabi_uread8((void*) bytes) == 0x7766554433221100ll, 1);
+    ASSERT_EQUAL(__aeabi_uread8((void*) (bytes + 1)) == (long long) 0x8877665544332211ull, 1);
+    ASSERT_EQUAL(__aeabi_uread8((void*) (bytes + 2)) == (long long) 0x9988776655443322ull, 1);
+    ASSERT_EQUAL(__aeabi_uread8((void*) (bytes + 3)) == (long long) 0xaa99887766554433ull, 1);
+}
+
+AGBTEST(aeabi, uwrite4) {
+    for (int i = 0; i < 4; ++i) {
+        unsigned char buffer[8] __attribute__((aligned(4))) = {0};
+        ASSERT_EQUAL(__aeabi_uwrite4(0x44332211, buffer + i), 0x44332211);
+        for (int j = 0; j < 8; ++j) {
+            ASSERT_EQUAL(buffer[j], j < i || j >= i + 4 ? 0 : 0x11 * (j - i + 1));
+        }
+    }
+}
+
+AGBTEST(aeabi, uwrite8) {
+    for (int i = 0; i < 4; ++i) {
+        unsigned char buffer[12] __attribute__((aligned(4))) = {0};
+        ASSERT_EQUAL(__aeabi_uwrite8(0x0877665544332211ll, buffer + i) == 0x0877665544332211ll, 1);
+        for (int j = 0; j < 12; ++j) {
+            ASSERT_EQUAL(buffer[j], j < i || j >= i + 8 ? 0 : j == i + 7 ? 0x08 : 0x11 * (j - i + 1));
+        }
+    }
+}
+
+static float to_float(unsigned int bits) {
+    union { unsigned int u; float f; } x = {bits};
+    return x.f;
+}
+
+static unsigned int to_bits(float f) {
+    union { float f; unsigned int u; } x = {f};
+    return x.u;
+}
+
+#define FLOAT_TEST(FN, A, B, EXPECTED) ASSERT_EQUAL(to_bits(FN(to_float(A), to_float(B))), (EXPECTED))
+#define IS_NAN(X) ((to_bits(X) & 0x7fffffffu) > 0x7f800000u)
+
+AGBTEST(aeabi, fadd) {
+    FLOAT_TEST(__aeabi_fadd, 0x3fc00000u, 0x40100000u, 0x40700000u); /* 1.5 + 2.25 */
+    FLOAT_TEST(__aeabi_fadd, 0x3f800000u, 0x33800000u, 0x3f800000u); /* Halfway rounds to even */
+    FLOAT_TEST(__aeabi_fadd, 0x3f800001u, 0x33800000u, 0x3f800002u);
+    FLOAT_TEST(__aeabi_fadd, 0x3f800000u, 0x33800001u, 0x3f800001u);
+    FLOAT_TEST(__aeabi_fadd, 0x80000000u, 0x00000000u, 0x00000000u);
+    FLOAT_TEST(__aeabi_fadd, 0x80000000u, 0x80000000u, 0x80000000u);
+    FLOAT_TEST(__aeabi_fadd, 0x00400000u, 0x00400001u, 0x00800001u); /* Denormals */
+    FLOAT_TEST(__aeabi_fadd, 0x7f7fffffu, 0x73800000u, 0x7f800000u); /* Overflow */
+    FLOAT_TEST(__aeabi_fsub, 0x3fc00000u, 0x3fc00000u, 0x00000000u);
+    FLOAT_TEST(__aeabi_fsub, 0x00800000u, 0x00000001u, 0x007fffffu);
+    FLOAT_TEST(__aeabi_frsub, 0x3f800000u, 0x40000000u, 0x3f800000u);
+    ASSERT_EQUAL(IS_NAN(__aeabi_fadd(to_float(0x7f800000u), to_float(0xff800000u))), 1);
+    ASSERT_EQUAL(IS_NAN(__aeabi_fadd(to_float(0x7fc00000u), to_float(0x3f800000u))), 1);
+}
+
+AGBTEST(aeabi, fmul) {
+    FLOAT_TEST(__aeabi_fmul, 0x40400000u, 0x3dcccccdu, 0x3e99999au); /* 3 * 0.1 */
+    FLOAT_TEST(__aeabi_fmul, 0x1f800000u, 0x1f800000u, 0x00200000u); /* Denormal result */
+    FLOAT_TEST(__aeabi_fmul, 0x00000001u, 0x4b000000u, 0x00800000u); /* Denormal operand */
+    FLOAT_TEST(__aeabi_fmul, 0x80000003u, 0x3f000000u, 0x80000002u); /* Halfway denormal rounds to even */
+    FLOAT_TEST(__aeabi_fmul, 0x7f000000u, 0x40000000u, 0x7f800000u); /* Overflow */
+    ASSERT_EQUAL(IS_NAN(__aeabi_fmul(to_float(0x7f800000u), to_float(0x00000000u))), 1);
+}
+
+AGBTEST(aeabi, fdiv) {
+    FLOAT_TEST(__aeabi_fdiv, 0x3f800000u, 0x40400000u, 0x3eaaaaabu); /* 1 / 3 */
+    FLOAT_TEST(__aeabi_fdiv, 0xc0c00000u, 0x40000000u, 0xc0400000u);
+    FLOAT_TEST(__aeabi_fdiv, 0x3f800000u, 0x00000000u, 0x7f800000u);
+    FLOAT_TEST(__aeabi_fdiv, 0x00000003u, 0x40000000u, 0x00000002u);
+    FLOAT_TEST(__aeabi_fdiv, 0x00800000u, 0x7f000000u, 0x00000000u); /* Underflow */
+    ASSERT_EQUAL(IS_NAN(__aeabi_fdiv(to_float(0x00000000u), to_float(0x00000000u))), 1);
+}
+
+AGBTEST(aeabi, fconvert) {
+    ASSERT_EQUAL(to_bits(__aeabi_i2f(16777217)), 0x4b800000u);
+    ASSERT_EQUAL(to_bits(__aeabi_i2f(-0x7fffffff - 1)), 0xcf000000u);
+    ASSERT_EQUAL(to_bits(__aeabi_i2f(-7)), 0xc0e00000u);
+    ASSERT_EQUAL(to_bits(__aeabi_i2f(0)), 0x00000000u);
+    ASSERT_EQUAL(to_bits(__aeabi_ui2f(0xffffffffu)), 0x4f800000u);
+    ASSERT_EQUAL(to_bits(__aeabi_ui2f(0x1000003u)), 0x4b800002u);
+    ASSERT_EQUAL(to_bits(__aeabi_l2f(-7ll)), 0xc0e00000u);
+    ASSERT_EQUAL(to_bits(__aeabi_l2f(-0x7fffffffffffffffll - 1)), 0xdf000000u);
+    ASSERT_EQUAL(to_bits(__aeabi_l2f(0x100000100000001ll)), 0x5b800001u); /* Sticky bit in the low word rounds up */
+    ASSERT_EQUAL(to_bits(__aeabi_l2f(0x100000100000000ll)), 0x5b800000u); /* Halfway rounds to even */
+    ASSERT_EQUAL(to_bits(__aeabi_ul2f(0xffffffffffffffffull)), 0x5f800000u);
+    ASSERT_EQUAL(to_bits(__aeabi_ul2f(0x100000000ull)), 0x4f800000u);
+    ASSERT_EQUAL(to_bits(__aeabi_ul2f(0ull)), 0x00000000u);
+
+    ASSERT_EQUAL(__aeabi_f2iz(to_float(0xbfc00000u)), -1);
+    ASSERT_EQUAL(__aeabi_f2iz(to_float(0x4f32d05eu)), 0x7fffffff); /* 3e9 saturates */
+    ASSERT_EQUAL(__aeabi_f2iz(to_float(0xcf000000u)), -0x7fffffff - 1);
+    ASSERT_EQUAL(__aeabi_f2iz(to_float(0x7fc00000u)), 0);
+    ASSERT_EQUAL(__aeabi_f2uiz(to_float(0xbf800000u)), 0u);
+    ASSERT_EQUAL(__aeabi_f2uiz(to_float(0x4f32d05eu)), 3000000000u);
+    ASSERT_EQUAL(__aeabi_f2uiz(to_float(0x4f800000u)), 0xffffffffu);
+}
+
+AGBTEST(aeabi, fcmp) {
+    const float pos_zero = to_float(0x00000000u);
+    const float neg_zero = to_float(0x80000000u);
+    const float nan = to_float(0x7fc00000u);
+
+    ASSERT_EQUAL(__aeabi_fcmpeq(pos_zero, neg_zero), 1);
+    ASSERT_EQUAL(__aeabi_fcmpeq(nan, nan), 0);
+    ASSERT_EQUAL(__aeabi_fcmplt(neg_zero, pos_zero), 0);
+    ASSERT_EQUAL(__aeabi_fcmplt(to_float(0xc0000000u), to_float(0xbf800000u)), 1); /* -2 < -1 */
+    ASSERT_EQUAL(__aeabi_fcmplt(to_float(0xbf800000u), to_float(0x3f800000u)), 1);
+    ASSERT_EQUAL(__aeabi_fcmple(pos_zero, neg_zero), 1);
+    ASSERT_EQUAL(__aeabi_fcmple(nan, pos_zero), 0);
+    ASSERT_EQUAL(__aeabi_fcmpge(to_float(0x3f800000u), to_float(0x3f800000u)), 1);
+    ASSERT_EQUAL(__aeabi_fcmpge(to_float(0xbf800000u), to_float(0x3f800000u)), 0);
+    ASSERT_EQUAL(__aeabi_fcmpgt(to_float(0x7f800000u), to_float(0x7f7fffffu)), 1);
+    ASSERT_EQUAL(__aeabi_fcmpgt(pos_zero, nan), 0);
+    ASSERT_EQUAL(__aeabi_fcmpun(pos_zero, nan), 1);
+    ASSERT_EQUAL(__aeabi_fcmpun(pos_zero, neg_zero), 0);
+}
+
+static double to_double(unsigned long long bits) {
+    union { unsigned long long u; double d; } x = {bits};
+    return x.d;
+}
+
+static unsigned long long to_double_bits(double d) {
+    union { double d; unsigned long long u; } x = {d};
+    return x.u;
+}
+
+#define DOUBLE_TEST(FN, A, B, EXPECTED) ASSERT_EQUAL(to_double_bits(FN(to_double(A), to_double(B))), (EXPECTED))
+#define IS_DOUBLE_NAN(X) ((to_double_bits(X) & 0x7fffffffffffffffull) > 0x7ff0000000000000ull)
+
+AGBTEST(aeabi, dadd) {
+    DOUBLE_TEST(__aeabi_dadd, 0x3ff8000000000000ull, 0x4002000000000000ull, 0x400e000000000000ull); /* 1.5 + 2.25 */
+    DOUBLE_TEST(__aeabi_dadd, 0x3ff0000000000000ull, 0x3ca0000000000000ull, 0x3ff0000000000000ull); /* Halfway rounds to even */
+    DOUBLE_TEST(__aeabi_dadd, 0x3ff0000000000001ull, 0x3ca0000000000000ull, 0x3ff0000000000002ull);
+    DOUBLE_TEST(__aeabi_dadd, 0x3ff0000000000000ull, 0x3ca0000000000001ull, 0x3ff0000000000001ull);
+    DOUBLE_TEST(__aeabi_dadd, 0x8000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull);
+    DOUBLE_TEST(__aeabi_dadd, 0x0008000000000000ull, 0x0008000000000001ull, 0x0010000000000001ull); /* Denormals */
+    DOUBLE_TEST(__aeabi_dadd, 0x7fefffffffffffffull, 0x7ca0000000000000ull, 0x7ff0000000000000ull); /* Overflow */
+    DOUBLE_TEST(__aeabi_dsub, 0x3ff0000000000000ull, 0x3fefffffffffffffull, 0x3ca0000000000000ull);
+    DOUBLE_TEST(__aeabi_dsub, 0x0010000000000000ull, 0x0000000000000001ull, 0x000fffffffffffffull);
+    DOUBLE_TEST(__aeabi_drsub, 0x3ff0000000000000ull, 0x4000000000000000ull, 0x3ff0000000000000ull);
+    ASSERT_EQUAL(IS_DOUBLE_NAN(__aeabi_dadd(to_double(0x7ff0000000000000ull), to_double(0xfff0000000000000ull))), 1);
+}
+
+AGBTEST(aeabi, dmul) {
+    DOUBLE_TEST(__aeabi_dmul, 0x4008000000000000ull, 0x3fb999999999999aull, 0x3fd3333333333334ull); /* 3 * 0.1 */
+    DOUBLE_TEST(__aeabi_dmul, 0x1ff0000000000000ull, 0x1ff0000000000000ull, 0x0004000000000000ull); /* Denormal result */
+    DOUBLE_TEST(__aeabi_dmul, 0x0000000000000001ull, 0x4330000000000000ull, 0x0010000000000000ull); /* Denormal operand */
+    DOUBLE_TEST(__aeabi_dmul, 0x8000000000000003ull, 0x3fe0000000000000ull, 0x8000000000000002ull); /* Halfway denormal rounds to even */
+    DOUBLE_TEST(__aeabi_dmul, 0x7fe0000000000000ull, 0x4000000000000000ull, 0x7ff0000000000000ull); /* Overflow */
+    ASSERT_EQUAL(IS_DOUBLE_NAN(__aeabi_dmul(to_double(0x7ff0000000000000ull), to_double(0x0000000000000000ull))), 1);
+}
+
+AGBTEST(aeabi, ddiv) {
+    DOUBLE_TEST(__aeabi_ddiv, 0x3ff0000000000000ull, 0x4008000000000000ull, 0x3fd5555555555555ull); /* 1 / 3 */
+    DOUBLE_TEST(__aeabi_ddiv, 0xc018000000000000ull, 0x4000000000000000ull, 0xc008000000000000ull);
+    DOUBLE_TEST(__aeabi_ddiv, 0x3ff0000000000000ull, 0x0000000000000000ull, 0x7ff0000000000000ull);
+    DOUBLE_TEST(__aeabi_ddiv, 0x0000000000000003ull, 0x4000000000000000ull, 0x0000000000000002ull);
+    DOUBLE_TEST(__aeabi_ddiv, 0x0010000000000000ull, 0x7fe0000000000000ull, 0x0000000000000000ull); /* Underflow */
+    ASSERT_EQUAL(IS_DOUBLE_NAN(__aeabi_ddiv(to_double(0x0000000000000000ull), to_double(0x0000000000000000ull))), 1);
+}
+
+AGBTEST(aeabi, dconvert) {
+    ASSERT_EQUAL(to_double_bits(__aeabi_i2d(-7)), 0xc01c000000000000ull);
+    ASSERT_EQUAL(to_double_bits(__aeabi_i2d(-0x7fffffff - 1)), 0xc1e0000000000000ull);
+    ASSERT_EQUAL(to_double_bits(__aeabi_i2d(0)), 0x0000000000000000ull);
+    ASSERT_EQUAL(to_double_bits(__aeabi_ui2d(0xffffffffu)), 0x41efffffffe00000ull);
+    ASSERT_EQUAL(to_double_bits(__aeabi_l2d(-7ll)), 0xc01c000000000000ull);
+    ASSERT_EQUAL(to_double_bits(__aeabi_l2d(-0x7fffffffffffffffll - 1)), 0xc3e0000000000000ull);
+    ASSERT_EQUAL(to_double_bits(__aeabi_l2d(0x200000000000011ll)), 0x4380000000000001ull); /* Above halfway rounds up */
+    ASSERT_EQUAL(to_double_bits(__aeabi_l2d(0x200000000000010ll)), 0x4380000000000000ull); /* Halfway rounds to even */
+    ASSERT_EQUAL(to_double_bits(__aeabi_ul2d(0xffffffffffffffffull)), 0x43f0000000000000ull);
+    ASSERT_EQUAL(to_double_bits(__aeabi_ul2d(0ull)), 0x0000000000000000ull);
+
+    ASSERT_EQUAL(__aeabi_d2iz(to_double(0xbff8000000000000ull)), -1);
+    ASSERT_EQUAL(__aeabi_d2iz(to_double(0x41e65a0bc0000000ull)), 0x7fffffff); /* 3e9 saturates */
+    ASSERT_EQUAL(__aeabi_d2iz(to_double(0x7ff8000000000000ull)), 0);
+    ASSERT_EQUAL(__aeabi_d2uiz(to_double(0xbff0000000000000ull)), 0u);
+    ASSERT_EQUAL(__aeabi_d2uiz(to_double(0x41e65a0bc0000000ull)), 3000000000u);
+    ASSERT_EQUAL(__aeabi_d2uiz(to_double(0x41f0000000000000ull)), 0xffffffffu);
+
+    ASSERT_EQUAL(__aeabi_d2lz(to_double(0xc3e0000000000000ull)), -0x7fffffffffffffffll - 1);
+    ASSERT_EQUAL(__aeabi_d2lz(to_double(0x43e0000000000000ull)), 0x7fffffffffffffffll); /* 2^63 saturates */
+    ASSERT_EQUAL(__aeabi_d2lz(to_double(0xc3afffffffffffffull)), -0x0fffffffffffff80ll);
+    ASSERT_EQUAL(__aeabi_d2lz(to_double(0xbfefffffffffffffull)), 0ll);
+    ASSERT_EQUAL(__aeabi_d2lz(to_double(0x7ff8000000000000ull)), 0ll);
+    ASSERT_EQUAL(__aeabi_d2ulz(to_double(0x43efffffffffffffull)), 0xfffffffffffff800ull);
+    ASSERT_EQUAL(__aeabi_d2ulz(to_double(0x43f0000000000000ull)), 0xffffffffffffffffull); /* 2^64 saturates */
+    ASSERT_EQUAL(__aeabi_d2ulz(to_double(0xc000000000000000ull)), 0ull);
+    ASSERT_EQUAL(__aeabi_d2ulz(to_double(0x41f0000000000000ull)), 0x100000000ull);
+
+    ASSERT_EQUAL(to_double_bits(__aeabi_f2d(to_float(0x3dcccccdu))), 0x3fb99999a0000000ull);
+    ASSERT_EQUAL(to_double_bits(__aeabi_f2d(to_float(0x00000001u))), 0x36a0000000000000ull); /* Denormal becomes normal */
+    ASSERT_EQUAL(to_bits(__aeabi_d2f(to_double(0x3fb999999999999aull))), 0x3dcccccdu);
+    ASSERT_EQUAL(to_bits(__aeabi_d2f(to_double(0x3ff0000010000000ull))), 0x3f800000u); /* Halfway rounds to even */
+    ASSERT_EQUAL(to_bits(__aeabi_d2f(to_double(0x3ff0000030000000ull))), 0x3f800002u);
+    ASSERT_EQUAL(to_bits(__aeabi_d2f(to_double(0x7e37e43c8800759cull))), 0x7f800000u); /* 1e300 overflows */
+}
+
+AGBTEST(aeabi, dcmp) {
+    const double pos_zero = to_double(0x0000000000000000ull);
+    const double neg_zero = to_double(0x8000000000000000ull);
+    const double nan = to_double(0x7ff8000000000000ull);
+
+    ASSERT_EQUAL(__aeabi_dcmpeq(pos_zero, neg_zero), 1);
+    ASSERT_EQUAL(__aeabi_dcmpeq(nan, nan), 0);
+    ASSERT_EQUAL(__aeabi_dcmpeq(to_double(0x3ff0000000000000ull), to_double(0x3ff0000000000001ull)), 0);
+    ASSERT_EQUAL(__aeabi_dcmplt(neg_zero, pos_zero), 0);
+    ASSERT_EQUAL(__aeabi_dcmplt(to_double(0xc000000000000000ull), to_double(0xbff0000000000000ull)), 1); /* -2 < -1 */
+    ASSERT_EQUAL(__aeabi_dcmplt(to_double(0x3ff0000000000000ull), to_double(0x3ff0000000000001ull)), 1);
+    ASSERT_EQUAL(__aeabi_dcmple(pos_zero, neg_zero), 1);
+    ASSERT_EQUAL(__aeabi_dcmple(nan, pos_zero), 0);
+    ASSERT_EQUAL(__aeabi_dcmpge(to_double(0xbff0000000000000ull), to_double(0x3ff0000000000000ull)), 0);
+    ASSERT_EQUAL(__aeabi_dcmpgt(to_double(0x7ff0000000000000ull), to_double(0x7fefffffffffffffull)), 1);
+    ASSERT_EQUAL(__aeabi_dcmpgt(pos_zero, nan), 0);
+    ASSERT_EQUAL(__aeabi_dcmpun(to_double(0x7ff0000000000001ull), pos_zero), 1);
+    ASSERT_EQUAL(__aeabi_dcmpun(pos_zero, neg_zero), 0);
+}
@@ -0,0 +1,61 @@
+#include "agbtest.h"
+
+/* libgcc helpers, called by __builtin_clz, __builtin_ctz and __builtin_popcount */
+int __clzsi2(unsigned int x);
+int __clzdi2(unsigned long long x);
+int __ctzsi2(unsigned int x);
+int __ctzdi2(unsigned long long x);
+int __popcountsi2(unsigned int x);
+int __popcountdi2(unsigned long long x);
+
+static int reference_popcount(unsigned long long x) {
+    int n = 0;
+    for (; x; x >>= 1) {
+        n += (int) (x & 1);
+    }
+    return n;
+}
+
+/* Each leading bit position, with every lower bit clear, set, or alternating */
+AGBTEST(bits, clz) {
+    ASSERT_EQUAL(__clzsi2(0), 32);
+    ASSERT_EQUAL(__clzdi2(0), 64);
+    for (int i = 0; i < 32; ++i) {
+        const unsigned int bit = 1u << i;
+        const unsigned int below[] = {0, bit - 1, (bit - 1) & 0x55555555, (bit - 1) & 0xaaaaaaaa};
+        for (size_t j = 0; j < sizeof(below) / sizeof(below[0]); ++j) {
+            ASSERT_EQUAL(__clzsi2(bit | below[j]), 31 - i);
+            ASSERT_EQUAL(__clzdi2(bit | below[j]), 63 - i);
+            ASSERT_EQUAL(__clzdi2((unsigned long long) (bit | below[j]) << 32 | 0xffffffff), 31 - i);
+        }
+    }
+}
+
+/* Each trailing bit position, with every higher bit clear, set, or alternating */
+AGBTEST(bits, ctz) {
+    ASSERT_EQUAL(__ctzsi2(0), 32);
+    ASSERT_EQUAL(__ctzdi2(0), 64);
+    for (int i = 0; i < 32; ++i) {
+        const unsigned int bit = 1u << i;
+        const unsigned int above[] = {0, ~(bit | (bit - 1)), ~(bit | (bit - 1)) & 0x55555555, ~(bit | (bit - 1)) & 0xaaaaaaaa};
+        for (size_t j = 0; j < sizeof(above) / sizeof(above[0]); ++j) {
+            ASSERT_EQUAL(__ctzsi2(bit | above[j]), i);
+            ASSERT_EQUAL(__ctzdi2(bit | above[j]), i);
+            ASSERT_EQUAL(__ctzdi2((unsigned long long) (bit | above[j]) << 32), 32 + i);
+        }
+    }
+}
+
+/* Every 16-bit pattern in each half of the word */
+AGBTEST(bits, popcount) {
+    unsigned int mismatches = 0;
+    for (unsigned int x = 0; x < 0x10000; ++x) {
+        const int expected = reference_popcount(x);
+        mismatches += __popcountsi2(x) != expected;
+        mismatches += __popcountsi2(x << 16) != expected;
+        mismatches += __popcountsi2(x * 0x10001) != expected * 2;
+        mismatches += __popcountdi2(x * 0x100010001ull) != expected * 3;
+        mismatches += __popcountdi2(~(unsigned long long) x) != 64 - expected;
+    }
+    ASSERT_EQUAL(mismatches, 0);
+}
@@ -0,0 +1,164 @@
+#include <aeabi.h>
+#include <agbabi.h>
+
+#include "agbtest.h"
+
+static const unsigned int denominators[] = {1, 2, 3, 7, 10, 60, 641, 65535, 65536, 0x12345, 0x7fffffff, 0x80000000, 0x80000001, 0xffffffff};
+static const unsigned int numerators[] = {0, 1, 6, 7, 1000, 65535, 0x12345678, 0x7fffffff, 0x80000000, 0xfffffffe, 0xffffffff};
+
+#define COUNT(ARRAY) (sizeof(ARRAY) / sizeof(ARRAY[0]))
+
+AGBTEST(divide, udiv_prepared) {
+    for (size_t i = 0; i < COUNT(denominators); ++i) {
+        __agbabi_udiv_t div;
+        __agbabi_udiv_prepare(&div, denominators[i]);
+        for (size_t j = 0; j < COUNT(numerators); ++j) {
+            ASSERT_EQUAL(__agbabi_udiv_prepared(numerators[j], &div), numerators[j] / denominators[i]);
+        }
+    }
+}
+
+AGBTEST(divide, idiv_prepared) {
+    for (size_t i = 0; i < COUNT(denominators); ++i) {
+        const int d[2] = {(int) denominators[i], (int) (0u - denominators[i])};
+        for (size_t k = 0; k < 2; ++k) {
+            __agbabi_idiv_t div;
+            __agbabi_idiv_prepare(&div, d[k]);
+            for (size_t j = 0; j < COUNT(numerators); ++j) {
+                const int n = (int) numerators[j];
+                /* INT_MIN / -1 overflows */
+                if (n == (int) 0x80000000 && d[k] == -1) {
+                    continue;
+                }
+                ASSERT_EQUAL(__agbabi_idiv_prepared(n, &div), n / d[k]);
+            }
+        }
+    }
+}
+
+AGBTEST(divide, uluidiv_prepared) {
+    static const unsigned long long numerators64[] = {0, 7, 0xffffffff, 0x100000000ull, 1000000000000000000ull, 0x8000000000000000ull, 0xffffffffffffffffull};
+    for (size_t i = 0; i < COUNT(denominators); ++i) {
+        __agbabi_uluidiv_t div;
+        __agbabi_uluidiv_prepare(&div, denominators[i]);
+        for (size_t j = 0; j < COUNT(numerators64); ++j) {
+            ASSERT_EQUAL(__agbabi_uluidiv_prepared(numerators64[j], &div), __agbabi_uluidiv(numerators64[j], denominators[i]));
+        }
+    }
+}
+
+AGBTEST(divide, uidiv_array) {
+    unsigned int quotients[COUNT(numerators) + 1];
+    unsigned int remainders[COUNT(numerators) + 1];
+    for (size_t i = 0; i < COUNT(denominators); ++i) {
+        quotients[COUNT(numerators)] = 0xdeadbeef;
+        remainders[COUNT(numerators)] = 0xdeadbeef;
+        __agbabi_uidiv_array(quotients, numerators, denominators[i], COUNT(numerators));
+        __agbabi_uimod_array(remainders, numerators, denominators[i], COUNT(numerators));
+        for (size_t j = 0; j < COUNT(numerators); ++j) {
+            ASSERT_EQUAL(quotients[j], numerators[j] / denominators[i]);
+            ASSERT_EQUAL(remainders[j], numerators[j] % denominators[i]);
+        }
+        ASSERT_EQUAL(quotients[COUNT(numerators)], 0xdeadbeef);
+        ASSERT_EQUAL(remainders[COUNT(numerators)], 0xdeadbeef);
+    }
+}
+
+AGBTEST(divide, idiv_array) {
+    int quotients[COUNT(numerators)];
+    int remainders[COUNT(numerators)];
+    for (size_t i = 0; i < COUNT(denominators); ++i) {
+        const int d = (int) (0u - denominators[i]);
+        __agbabi_idiv_array(quotients, (const int*) numerators, d, COUNT(numerators));
+        __agbabi_imod_array(remainders, (const int*) numerators, d, COUNT(numerators));
+        for (size_t j = 0; j < COUNT(numerators); ++j) {
+            const int n = (int) numerators[j];
+            /* INT_MIN / -1 overflows */
+            if (n == (int) 0x80000000 && d == -1) {
+                continue;
+            }
+            ASSERT_EQUAL(quotients[j], n / d);
+            ASSERT_EQUAL(remainders[j], n % d);
+        }
+    }
+}
+
+AGBTEST(divide, uidiv_arrays) {
+    /* Pairs each numerator with the denominator at the same index */
+    unsigned int quotients[COUNT(numerators)];
+    __agbabi_uidiv_arrays(quotients, numerators, denominators, COUNT(numerators));
+    for (size_t j = 0; j < COUNT(numerators); ++j) {
+        ASSERT_EQUAL(quotients[j], numerators[j] / denominators[j]);
+    }
+}
+
+AGBTEST(divide, idiv_arrays) {
+    static const int signed_numerators[] = {-1000, 1000, -7, 0x7fffffff, (int) 0x80000000, 0};
+    static const int signed_denominators[] = {7, -7, -7, -3, 3, -1};
+    int quotients[COUNT(signed_numerators)];
+    __agbabi_idiv_arrays(quotients, signed_numerators, signed_denominators, COUNT(signed_numerators));
+    for (size_t j = 0; j < COUNT(signed_numerators); ++j) {
+        ASSERT_EQUAL(quotients[j], signed_numerators[j] / signed_denominators[j]);
+    }
+}
+
+AGBTEST(divide, ldiv) {
+    static const long long signed_numerators[] = {0, 7, -1000, 0x7fffffff, -0x80000000ll, 0x80000000ll, -1000000000000000000ll, 0x7fffffffffffffffll};
+    static const long long signed_denominators[] = {1, -1, 7, -7, 0x7fffffff, -0x80000000ll, 0x80000000ll, -1000000000000ll};
+    for (size_t i = 0; i < COUNT(signed_denominators); ++i) {
+        for (size_t j = 0; j < COUNT(signed_numerators); ++j) {
+            ASSERT_EQUAL(__agbabi_ldiv(signed_numerators[j], signed_denominators[i]), signed_numerators[j] / signed_denominators[i]);
+        }
+    }
+
+    /* Equal high words need the full bit count */
+    ASSERT_EQUAL(__agbabi_uldiv(0x7fffffffffffffffull, 8253380425ull), 0x7fffffffffffffffull / 8253380425ull);
+}
+
+AGBTEST(divide, lidiv) {
+    static const long long signed_numerators[] = {0, 7, -1000, -0x80000000ll, 0x80000000ll, 1ll << 40, -1000000000000000000ll, 0x7fffffffffffffffll};
+    static const int signed_denominators[] = {1, -1, 3, -7, 0x7fffffff, (int) 0x80000000};
+    for (size_t i = 0; i < COUNT(signed_denominators); ++i) {
+        for (size_t j = 0; j < COUNT(signed_numerators); ++j) {
+            ASSERT_EQUAL(__agbabi_lidiv(signed_numerators[j], signed_denominators[i]), signed_numerators[j] / signed_denominators[i]);
+        }
+    }
+
+    /* Denominators with the top bit set */
+    ASSERT_EQUAL(__agbabi_uluidiv(1ull << 40, 0xffffffff), (1ull << 40) / 0xffffffff);
+}
+
+static int fxdiv_reference(int numerator, int denominator, int q) {
+    const long long quotient = (long long) numerator * (1ll << q) / denominator;
+    if (quotient > 0x7fffffff) {
+        return 0x7fffffff;
+    }
+    if (quotient < -0x7fffffff - 1) {
+        return -0x7fffffff - 1;
+    }
+    return (int) quotient;
+}
+
+static const int fx_numerators[] = {0, 1, -1, 0x10000, -0x30000, 0x648000, 0x12345678, 0x7fffffff, (int) 0x80000000};
+static const int fx_denominators[] = {1, -1, 3, 0xc000, -0x10000, 0x30000, 0x7fffffff, (int) 0x80000000};
+
+#define FXDIV_TEST(Q) \
+    AGBTEST(divide, fxdiv##Q) { \
+        for (size_t i = 0; i < COUNT(fx_denominators); ++i) { \
+            for (size_t j = 0; j < COUNT(fx_numerators); ++j) { \
+                const int expected = fxdiv_reference(fx_numerators[j], fx_denominators[i], Q); \
+                ASSERT_EQUAL(__agbabi_fxdiv##Q(fx_numerators[j], fx_denominators[i]), expected); \
+                /* Rounds towards zero, by up to 2 */ \
+                const int approx = __agbabi_fxdiv##Q##_approx(fx_numerators[j], fx_denominators[i]); \
+                if (expected < 0) { \
+                    ASSERT_EQUAL(approx >= expected && approx <= expected + 2, 1); \
+                } else { \
+                    ASSERT_EQUAL(approx <= expected && approx >= expected - 2, 1); \
+                } \
+            } \
+        } \
+    }
+
+FXDIV_TEST(16)
+FXDIV_TEST(12)
+FXDIV_TEST(8)
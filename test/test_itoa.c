@@ -0,0 +1,62 @@
+#include <agbabi.h>
+
+#include "agbtest.h"
+
+AGBTEST(itoa, utoa10) {
+    char buffer[11];
+
+    ASSERT_EQUAL(__agbabi_utoa10(0, buffer) - buffer, 1);
+    ASSERT_MEMCMP(buffer, char, "0");
+    ASSERT_EQUAL(__agbabi_utoa10(99, buffer) - buffer, 2);
+    ASSERT_MEMCMP(buffer, char, "99");
+    ASSERT_EQUAL(__agbabi_utoa10(100, buffer) - buffer, 3);
+    ASSERT_MEMCMP(buffer, char, "100");
+    ASSERT_EQUAL(__agbabi_utoa10(1234567, buffer) - buffer, 7);
+    ASSERT_MEMCMP(buffer, char, "1234567");
+    ASSERT_EQUAL(__agbabi_utoa10(4294967295u, buffer) - buffer, 10);
+    ASSERT_MEMCMP(buffer, char, "4294967295");
+}
+
+AGBTEST(itoa, itoa10) {
+    char buffer[12];
+
+    ASSERT_EQUAL(__agbabi_itoa10(-1, buffer) - buffer, 2);
+    ASSERT_MEMCMP(buffer, char, "-1");
+    ASSERT_EQUAL(__agbabi_itoa10(2147483647, buffer) - buffer, 10);
+    ASSERT_MEMCMP(buffer, char, "2147483647");
+    ASSERT_EQUAL(__agbabi_itoa10(-2147483647 - 1, buffer) - buffer, 11);
+    ASSERT_MEMCMP(buffer, char, "-2147483648");
+}
+
+AGBTEST(itoa, ulltoa10) {
+    char buffer[21];
+
+    ASSERT_EQUAL(__agbabi_ulltoa10(4294967295ull, buffer) - buffer, 10);
+    ASSERT_MEMCMP(buffer, char, "4294967295");
+    ASSERT_EQUAL(__agbabi_ulltoa10(4294967296ull, buffer) - buffer, 10);
+    ASSERT_MEMCMP(buffer, char, "4294967296");
+    ASSERT_EQUAL(__agbabi_ulltoa10(100000000000000000ull, buffer) - buffer, 18);
+    ASSERT_MEMCMP(buffer, char, "100000000000000000");
+    ASSERT_EQUAL(__agbabi_ulltoa10(1000000000000000007ull, buffer) - buffer, 19);
+    ASSERT_MEMCMP(buffer, char, "1000000000000000007");
+    ASSERT_EQUAL(__agbabi_ulltoa10(18446744073709551615ull, buffer) - buffer, 20);
+    ASSERT_MEMCMP(buffer, char, "18446744073709551615");
+}
+
+AGBTEST(itoa, utoa16) {
+    char buffer[9];
+
+    ASSERT_EQUAL(__agbabi_utoa16(0, buffer) - buffer, 1);
+    ASSERT_MEMCMP(buffer, char, "0");
+    ASSERT_EQUAL(__agbabi_utoa16(0xbeef, buffer) - buffer, 4);
+    ASSERT_MEMCMP(buffer, char, "beef");
+    ASSERT_EQUAL(__agbabi_utoa16(0x80000000, buffer) - buffer, 8);
+    ASSERT_MEMCMP(buffer, char, "80000000");
+}
+
+AGBTEST(itoa, utobcd) {
+    ASSERT_EQUAL(__agbabi_utobcd(0), 0);
+    ASSERT_EQUAL(__agbabi_utobcd(1234), 0x1234);
+    ASSERT_EQUAL(__agbabi_utobcd(10203040), 0x10203040);
+    ASSERT_EQUAL(__agbabi_utobcd(99999999), 0x99999999);
+}
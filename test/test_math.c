@@ -0,0 +1,255 @@
+#include <agbabi.h>
+
+#include "agbtest.h"
+
+#define COUNT(ARRAY) (sizeof(ARRAY) / sizeof(ARRAY[0]))
+
+/* Perfect squares, and either side of them */
+AGBTEST(math, sqrt64) {
+    static const unsigned int roots[] = {0, 1, 2, 255, 256, 65535, 65536, 0x12345, 0xb504f333, 0xfffffffe, 0xffffffff};
+    for (size_t i = 0; i < COUNT(roots); ++i) {
+        const unsigned long long square = (unsigned long long) roots[i] * roots[i];
+        ASSERT_EQUAL(__agbabi_sqrt64(square), roots[i]);
+        if (roots[i]) {
+            ASSERT_EQUAL(__agbabi_sqrt64(square - 1), roots[i] - 1);
+        }
+        ASSERT_EQUAL(__agbabi_sqrt64(square + 2ull * roots[i]), roots[i]);
+    }
+    ASSERT_EQUAL(__agbabi_sqrt64(0xffffffffffffffffull), 0xffffffffu);
+    ASSERT_EQUAL(__agbabi_sqrt64(0x100000000ull), 0x10000u);
+}
+
+/* Within 2^-15 of 1 / sqrt(x) */
+#define RSQRT_TEST(X, EXPECTED) do { \
+    const unsigned int result = __agbabi_rsqrt(X); \
+    const unsigned int error = result > (EXPECTED) ? result - (EXPECTED) : (EXPECTED) - result; \
+    ASSERT_EQUAL(error <= ((EXPECTED) >> 15), 1); \
+} while (0)
+
+AGBTEST(math, rsqrt) {
+    RSQRT_TEST(0x10000u, 0x40000000u); /* 1.0 */
+    RSQRT_TEST(0x40000u, 0x20000000u); /* 4.0 */
+    RSQRT_TEST(0x4000u, 0x80000000u); /* 0.25 */
+    RSQRT_TEST(0x20000u, 759250125u); /* 2.0 */
+    RSQRT_TEST(0x640000u, 107374182u); /* 100.0 */
+    RSQRT_TEST(0xffffffffu, 4194304u);
+    RSQRT_TEST(0x1001u, 4294443104u);
+    ASSERT_EQUAL(__agbabi_rsqrt(0x1000u), 0xffffffffu);
+    ASSERT_EQUAL(__agbabi_rsqrt(0), 0xffffffffu);
+}
+
+/* Cosine is the sine a quarter turn ahead, and angles wrap at 15 bits */
+AGBTEST(math, sincos) {
+    static const int angles[] = {0, 0x1000, 0x2000, 0x3fff, 0x4000, 0x6000, 0x7fff, 0x8000, -0x1234, 0x12345};
+    for (size_t i = 0; i < COUNT(angles); ++i) {
+        const int __attribute__((vector_size(sizeof(int) * 2))) result = __agbabi_sincos(angles[i]);
+        ASSERT_EQUAL(result[0], __agbabi_sin(angles[i]));
+        ASSERT_EQUAL(result[1], __agbabi_sin(angles[i] + 0x2000));
+    }
+    ASSERT_EQUAL(__agbabi_sincos(0)[1], 1 << 29);
+}
+
+/* Odd and even lengths, without writing past the end */
+AGBTEST(math, sin_array) {
+    int buffer[34];
+    for (size_t n = 0; n < COUNT(buffer) - 1; ++n) {
+        buffer[n] = 0x5a5a5a5a;
+        __agbabi_sin_array(buffer, -0x1234, 0x321, n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQUAL(buffer[i], __agbabi_sin(-0x1234 + (int) i * 0x321));
+        }
+        ASSERT_EQUAL(buffer[n], 0x5a5a5a5a);
+    }
+}
+
+/* sin(2 pi angle / 0x8000) as Q29 */
+static const struct {
+    int angle;
+    int sine;
+} sines[] = {
+    {0x0, 0},
+    {0x123, 29941077},
+    {0x800, 205451603},
+    {0x1000, 379625062},
+    {0x1555, 464926690},
+    {0x1fff, 536870902},
+    {0x2000, 536870912},
+    {0x2abc, 464049103},
+    {0x4000, 0},
+    {0x5000, -379625062},
+    {0x6000, -536870912},
+    {0x7f00, -26343007},
+    {-0x1000, -379625062},
+    {0x9000, 379625062},
+};
+
+#define ASSERT_NEAR(A, B, TOLERANCE) ASSERT_EQUAL((A) - (B) <= (TOLERANCE) && (B) - (A) <= (TOLERANCE), 1)
+
+/* Within the documented max error of 8.7e-5 */
+AGBTEST(math, sin5) {
+    for (size_t i = 0; i < COUNT(sines); ++i) {
+        ASSERT_NEAR(__agbabi_sin5(sines[i].angle), sines[i].sine, 47000);
+    }
+    for (int angle = 0; angle < 0x8000; angle += 7) {
+        ASSERT_NEAR(__agbabi_sin5(angle), __agbabi_sin_lut(angle), 47000 + 2600);
+    }
+}
+
+/* Within the documented max error of 4.7e-6 */
+AGBTEST(math, sin_lut) {
+    for (size_t i = 0; i < COUNT(sines); ++i) {
+        ASSERT_NEAR(__agbabi_sin_lut(sines[i].angle), sines[i].sine, 2600);
+    }
+}
+
+/* Within 1 of __agbabi_atan2, exact on the axes and diagonals */
+AGBTEST(math, atan2_array) {
+    static const int coords[] = {
+        0, 0, -5, 0, 0, 7, 0, -7,
+        3, 3, -3, 3, -3, -3, 3, -3,
+        0x300, 0x400, -0x1234, 0x567, 0x7fff, -0x10000, -0x10000, -0x7fff,
+    };
+    static const unsigned int expected[] = {0, 0x4000, 0x2000, 0x6000, 0x1000, 0x3000, 0x5000, 0x7000};
+    unsigned int angles[COUNT(coords) / 2 + 1];
+
+    angles[COUNT(angles) - 1] = 0x5a5a5a5a;
+    __agbabi_atan2_array(angles, coords, COUNT(angles) - 1);
+    for (size_t i = 0; i < COUNT(expected); ++i) {
+        ASSERT_EQUAL(angles[i], expected[i]);
+    }
+    for (size_t i = 0; i < COUNT(angles) - 1; ++i) {
+        ASSERT_NEAR((int) angles[i], (int) __agbabi_atan2(coords[i * 2], coords[i * 2 + 1]), 1);
+    }
+    ASSERT_EQUAL(angles[COUNT(angles) - 1], 0x5a5a5a5a);
+
+    /* Coords that overflow __agbabi_atan2 */
+    static const int large[] = {1 << 24, 1 << 24, -0x40000000, 0x7fffffff, 0x7fffffff, -0x7fffffff};
+    __agbabi_atan2_array(angles, large, 3);
+    ASSERT_EQUAL(angles[0], 0x1000);
+    ASSERT_EQUAL(angles[1], 0x2972);
+    ASSERT_EQUAL(angles[2], 0x7000);
+}
+
+/* Exact at quarter turns, both strides */
+AGBTEST(math, obj_affine_set) {
+    static const __agbabi_obj_affine_src_t src[] = {
+        {0x100, 0x100, 0x0000, 0},
+        {0x100, 0x100, 0x4000, 0},
+        {0x100, -0x80, 0xc000, 0},
+        {0x100, 0x100, 0x8000, 0},
+        {0x200, 0x200, 0x2000, 0},
+    };
+    static const short expected[][4] = {
+        {0x100, 0, 0, 0x100},
+        {0, -0x100, 0x100, 0},
+        {0, 0x100, 0x80, 0},
+        {-0x100, 0, 0, -0x100},
+        {352, -352, 352, 352},
+    };
+    short packed[COUNT(src) * 4 + 1];
+    unsigned short oam[COUNT(src) * 16];
+
+    packed[COUNT(packed) - 1] = 0x5a5a;
+    __agbabi_obj_affine_set(src, packed, COUNT(src), 2);
+    __agbabi_obj_affine_set(src, &oam[3], COUNT(src), 8);
+    for (size_t i = 0; i < COUNT(src); ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            ASSERT_EQUAL(packed[i * 4 + j], expected[i][j]);
+            ASSERT_EQUAL((short) oam[i * 16 + j * 4 + 3], expected[i][j]);
+        }
+    }
+    ASSERT_EQUAL(packed[COUNT(packed) - 1], 0x5a5a);
+}
+
+/* The screen center maps to the texture center */
+AGBTEST(math, bg_affine_set) {
+    static const __agbabi_bg_affine_src_t src[] = {
+        {120 << 8, 80 << 8, 120, 80, 0x100, 0x100, 0x4000, 0},
+        {64 << 8, 32 << 8, 120, 80, 0x80, 0x100, 0x2000, 0},
+    };
+    __agbabi_bg_affine_dst_t dest[COUNT(src)];
+
+    __agbabi_bg_affine_set(src, dest, COUNT(src));
+    ASSERT_EQUAL(dest[0].pa, 0);
+    ASSERT_EQUAL(dest[0].pb, -0x100);
+    ASSERT_EQUAL(dest[0].pc, 0x100);
+    ASSERT_EQUAL(dest[0].pd, 0);
+    ASSERT_EQUAL(dest[0].dx, 51200);
+    ASSERT_EQUAL(dest[0].dy, -10240);
+    ASSERT_EQUAL(dest[1].pa, 88);
+    ASSERT_EQUAL(dest[1].pb, -88);
+    ASSERT_EQUAL(dest[1].pc, 176);
+    ASSERT_EQUAL(dest[1].pd, 176);
+    ASSERT_EQUAL(dest[1].dx, 12864);
+    ASSERT_EQUAL(dest[1].dy, -27008);
+}
+
+/* Exact powers of two, rounding, and saturation */
+AGBTEST(math, exp2) {
+    ASSERT_EQUAL(__agbabi_exp2(0), 0x10000u);
+    ASSERT_EQUAL(__agbabi_exp2(0x10000), 0x20000u);
+    ASSERT_EQUAL(__agbabi_exp2(-0x10000), 0x8000u);
+    ASSERT_EQUAL(__agbabi_exp2(15 << 16), 0x80000000u);
+    ASSERT_EQUAL(__agbabi_exp2(0x8000), 92682u); /* sqrt(2) */
+    ASSERT_EQUAL(__agbabi_exp2(0x12345), 144206u);
+    ASSERT_EQUAL(__agbabi_exp2(16 << 16), 0xffffffffu);
+    ASSERT_EQUAL(__agbabi_exp2(-(16 << 16)), 1u);
+    ASSERT_EQUAL(__agbabi_exp2(-(17 << 16)), 1u);
+    ASSERT_EQUAL(__agbabi_exp2(-(17 << 16) - 1), 0u);
+}
+
+/* Same values as __agbabi_exp2, without writing past the end */
+AGBTEST(math, exp2_array) {
+    unsigned int buffer[34];
+    for (size_t n = 0; n < COUNT(buffer) - 1; ++n) {
+        buffer[n] = 0x5a5a5a5a;
+        __agbabi_exp2_array(buffer, 0x12345, -0x4321, n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQUAL(buffer[i], __agbabi_exp2(0x12345 - (int) i * 0x4321));
+        }
+        ASSERT_EQUAL(buffer[n], 0x5a5a5a5au);
+    }
+}
+
+AGBTEST(math, log2) {
+    ASSERT_EQUAL(__agbabi_log2(0x10000u), 0);
+    ASSERT_EQUAL(__agbabi_log2(0x20000u), 0x10000);
+    ASSERT_EQUAL(__agbabi_log2(0x8000u), -0x10000);
+    ASSERT_EQUAL(__agbabi_log2(0x30000u), 103872);
+    ASSERT_EQUAL(__agbabi_log2(1u), -(16 << 16));
+    ASSERT_EQUAL(__agbabi_log2(0xffffffffu), 16 << 16);
+    ASSERT_EQUAL(__agbabi_log2(0u), (int) 0x80000000);
+}
+
+AGBTEST(math, pow) {
+    ASSERT_EQUAL(__agbabi_pow(0x40000u, 0x8000), 0x20000u);
+    ASSERT_EQUAL(__agbabi_pow(0x20000u, 0x30000), 0x80000u);
+    ASSERT_EQUAL(__agbabi_pow(0x8000u, 0x20000), 0x4000u);
+    ASSERT_EQUAL(__agbabi_pow(0x30000u, 0x18000), 340535u);
+    ASSERT_EQUAL(__agbabi_pow(0x10000u, -0x7fffffff), 0x10000u);
+    ASSERT_EQUAL(__agbabi_pow(0x20000u, 16 << 16), 0xffffffffu);
+    ASSERT_EQUAL(__agbabi_pow(0u, 0), 0x10000u);
+    ASSERT_EQUAL(__agbabi_pow(0u, 0x10000), 0u);
+    ASSERT_EQUAL(__agbabi_pow(0u, -0x10000), 0xffffffffu);
+}
+
+/* Large |y| scales the error of log2(x), within |y| * 2^-28 relative */
+AGBTEST(math, pow_large_y) {
+    ASSERT_NEAR((int) __agbabi_pow(0x10001u, 0x7fff0000), 108049, 14); /* 108048.5 */
+    ASSERT_NEAR((int) __agbabi_pow(0xffefu, (int) 0x93eecbe9), 85808051, 8844); /* 85808050.6 */
+    ASSERT_EQUAL(__agbabi_pow(0x10000u, 0x7fffffff), 0x10000u);
+    ASSERT_EQUAL(__agbabi_pow(0x8000u, 0x7fff0000), 0u);
+    ASSERT_EQUAL(__agbabi_pow(0x8000u, (int) 0x80010000), 0xffffffffu);
+}
+
+/* Same values as __agbabi_pow, in place */
+AGBTEST(math, pow_array) {
+    unsigned int buffer[33];
+    for (size_t i = 0; i < COUNT(buffer); ++i) {
+        buffer[i] = (unsigned int) i * 0x800;
+    }
+    __agbabi_pow_array(buffer, buffer, 0x28000, COUNT(buffer));
+    for (size_t i = 0; i < COUNT(buffer); ++i) {
+        ASSERT_EQUAL(buffer[i], __agbabi_pow((unsigned int) i * 0x800, 0x28000));
+    }
+}
@@ -1,4 +1,5 @@
 #include <aeabi.h>
+#include <agbabi.h>
 
 #include "agbtest.h"
 
@@ -59,6 +60,235 @@ AGBTEST(memcpy, struct) {
     ASSERT_EQUAL(dest.d, 1);
 }
 
+#define MEMCPY_SHIFT_TEST(OFFDST, OFFSRC, LEN) \
+    AGBTEST(memcpy, shift_##OFFDST##_##OFFSRC##_##LEN) { \
+        char dest[LEN + 8] __attribute__((aligned(4))); \
+        fill_ascii_buffer(dest, sizeof(dest), 'a'); \
+        char src[LEN + 8] __attribute__((aligned(4))); \
+        fill_ascii_buffer(src, sizeof(src), 'A'); \
+        __aeabi_memcpy(&dest[OFFDST], &src[OFFSRC], LEN); \
+        for (int i = 0; i < (int) sizeof(dest); ++i) { \
+            const char expected = (i < OFFDST || i >= OFFDST + LEN) ? (char) ('a' + (i % 26)) : src[i - OFFDST + OFFSRC]; \
+            ASSERT_EQUAL(dest[i], expected); \
+        } \
+    }
+
+MEMCPY_SHIFT_TEST(0, 1, 12)
+MEMCPY_SHIFT_TEST(0, 2, 32)
+MEMCPY_SHIFT_TEST(0, 3, 12)
+MEMCPY_SHIFT_TEST(1, 0, 71)
+MEMCPY_SHIFT_TEST(2, 0, 71)
+MEMCPY_SHIFT_TEST(3, 0, 71)
+MEMCPY_SHIFT_TEST(1, 2, 100)
+MEMCPY_SHIFT_TEST(3, 2, 100)
+MEMCPY_SHIFT_TEST(2, 3, 37)
+
+#define DMA_MEMCPY_TEST(OFFDST, OFFSRC, LEN) \
+    AGBTEST(memcpy, dma_##OFFDST##_##OFFSRC##_##LEN) { \
+        static char dest[LEN + 8] __attribute__((aligned(4))); \
+        fill_ascii_buffer(dest, sizeof(dest), 'a'); \
+        static char src[LEN + 8] __attribute__((aligned(4))); \
+        fill_ascii_buffer(src, sizeof(src), 'A'); \
+        __agbabi_dma_memcpy(&dest[OFFDST], &src[OFFSRC], LEN); \
+        for (int i = 0; i < (int) sizeof(dest); ++i) { \
+            const char expected = (i < OFFDST || i >= OFFDST + LEN) ? (char) ('a' + (i % 26)) : src[i - OFFDST + OFFSRC]; \
+            ASSERT_EQUAL(dest[i], expected); \
+        } \
+    }
+
+DMA_MEMCPY_TEST(0, 0, 1024)
+DMA_MEMCPY_TEST(1, 1, 1023)
+DMA_MEMCPY_TEST(2, 0, 1023)
+DMA_MEMCPY_TEST(3, 0, 1023)
+
+static int dma_queue_callbacks;
+
+static void dma_queue_callback(const __agbabi_dma_desc_t* desc) {
+    (void) desc;
+    ++dma_queue_callbacks;
+}
+
+/* A count of 0 would start a maximum length DMA, so these complete without one */
+AGBTEST(memcpy, dma_queue_zero) {
+    static char dest[8] __attribute__((aligned(4)));
+    static const char src[8] __attribute__((aligned(4))) = "ABCDEFG";
+    fill_ascii_buffer(dest, sizeof(dest), 'a');
+    const __agbabi_dma_desc_t desc[] = {
+        {src, dest, 0, 3, 0, dma_queue_callback},
+        {src, dest, 0, 0, 0, dma_queue_callback}
+    };
+    const __agbabi_dma_queue_stats_t before = __agbabi_dma_queue_stats();
+
+    dma_queue_callbacks = 0;
+    ASSERT_EQUAL(__agbabi_dma_queue_submit(desc, 2), 2);
+    ASSERT_EQUAL(dma_queue_callbacks, 2);
+    ASSERT_EQUAL(__agbabi_dma_queue_busy(), 0);
+    ASSERT_EQUAL(__agbabi_dma_queue_stats().completed - before.completed, 2);
+    for (int i = 0; i < (int) sizeof(dest); ++i) {
+        ASSERT_EQUAL(dest[i], (char) ('a' + i));
+    }
+}
+
+/* 16-bit DMA would round these down or drop the last byte */
+AGBTEST(memcpy, dma_queue_odd) {
+    static char dest[8] __attribute__((aligned(4)));
+    static const char src[8] __attribute__((aligned(4))) = "ABCDEFG";
+    const __agbabi_dma_desc_t desc[] = {
+        {src, dest, 3, 3, 0, dma_queue_callback},
+        {&src[1], dest, 2, 3, 0, dma_queue_callback},
+        {src, &dest[1], 2, 3, 0, dma_queue_callback}
+    };
+
+    dma_queue_callbacks = 0;
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQUAL(__agbabi_dma_queue_submit(&desc[i], 1), 0);
+    }
+    ASSERT_EQUAL(dma_queue_callbacks, 0);
+    ASSERT_EQUAL(__agbabi_dma_queue_busy(), 0);
+}
+
+#define DMA_QUEUE_IME (*(volatile unsigned short*) 0x4000208)
+#define DMA_QUEUE_IE (*(volatile unsigned short*) 0x4000200)
+
+static int dma_queue_order[4];
+
+static void dma_queue_record(const __agbabi_dma_desc_t* desc) {
+    dma_queue_order[dma_queue_callbacks++] = (int) desc->n;
+}
+
+/* IRQs are disabled and the handler called by hand, as immediate DMA completes before the next instruction */
+AGBTEST(memcpy, dma_queue_chain) {
+    static char dest[3][68] __attribute__((aligned(4)));
+    static char src[68] __attribute__((aligned(4)));
+    fill_ascii_buffer(src, sizeof(src), 'A');
+    fill_ascii_buffer(dest, sizeof(dest), 'a');
+    const __agbabi_dma_desc_t desc[] = {
+        {src, dest[0], 64, 3, 0, dma_queue_record},
+        {&src[2], &dest[1][2], 34, 0, 0, dma_queue_record},
+        {src, dest[2], 0, 3, 0, dma_queue_record},
+        {src, dest[2], 20, 1, 0, dma_queue_record}
+    };
+
+    const unsigned short ime = DMA_QUEUE_IME;
+    DMA_QUEUE_IME = 0;
+
+    dma_queue_callbacks = 0;
+    const size_t submitted = __agbabi_dma_queue_submit(desc, 4);
+    const int busy = __agbabi_dma_queue_busy();
+    int drained = 0;
+    for (int i = 0; i < 8 && __agbabi_dma_queue_busy(); ++i) {
+        drained |= __agbabi_dma_queue_irq(0x0f00);
+    }
+    const int ie = DMA_QUEUE_IE & 0x0f00;
+
+    DMA_QUEUE_IME = ime;
+
+    ASSERT_EQUAL(submitted, 4);
+    ASSERT_EQUAL(busy, 1);
+    ASSERT_EQUAL(__agbabi_dma_queue_busy(), 0);
+    ASSERT_EQUAL(dma_queue_callbacks, 4);
+    ASSERT_EQUAL(dma_queue_order[0], 64);
+    ASSERT_EQUAL(dma_queue_order[1], 34);
+    ASSERT_EQUAL(dma_queue_order[2], 0);
+    ASSERT_EQUAL(dma_queue_order[3], 20);
+    ASSERT_EQUAL(drained & 0x0b00, 0x0b00);
+    ASSERT_EQUAL(ie & 0x0b00, 0);
+
+    for (int i = 0; i < 68; ++i) {
+        ASSERT_EQUAL(dest[0][i], i < 64 ? src[i] : (char) ('a' + (i % 26)));
+        ASSERT_EQUAL(dest[1][i], (i >= 2 && i < 36) ? src[i] : (char) ('a' + ((68 + i) % 26)));
+        ASSERT_EQUAL(dest[2][i], i < 20 ? src[i] : (char) ('a' + ((136 + i) % 26)));
+    }
+}
+
+/* One unit past the count limit, so each transfer is split in two */
+static char dma_queue_split_dest[0x20008] __attribute__((aligned(4), section(".ewram")));
+
+#define DMA_QUEUE_SPLIT_TEST(NAME, CHANNEL, LEN) \
+    AGBTEST(memcpy, dma_queue_split_##NAME) { \
+        /* The ROM is larger than the buffer, as it holds its initial data */ \
+        const char* src = (const char*) 0x8000002; \
+        char* dest = &dma_queue_split_dest[2]; \
+        dest[-1] = 'a'; \
+        dest[LEN] = 'z'; \
+        const __agbabi_dma_desc_t desc = {src, dest, LEN, CHANNEL, 0, dma_queue_callback}; \
+        \
+        const unsigned short ime = DMA_QUEUE_IME; \
+        DMA_QUEUE_IME = 0; \
+        \
+        dma_queue_callbacks = 0; \
+        const size_t submitted = __agbabi_dma_queue_submit(&desc, 1); \
+        const int first = __agbabi_dma_queue_irq(0x100 << CHANNEL); \
+        const int busy = __agbabi_dma_queue_busy(); \
+        const int callbacks = dma_queue_callbacks; \
+        const int second = __agbabi_dma_queue_irq(0x100 << CHANNEL); \
+        \
+        DMA_QUEUE_IME = ime; \
+        \
+        ASSERT_EQUAL(submitted, 1); \
+        ASSERT_EQUAL(first, 0); \
+        ASSERT_EQUAL(busy, 1); \
+        ASSERT_EQUAL(callbacks, 0); \
+        ASSERT_EQUAL(second, 0x100 << CHANNEL); \
+        ASSERT_EQUAL(__agbabi_dma_queue_busy(), 0); \
+        ASSERT_EQUAL(dma_queue_callbacks, 1); \
+        ASSERT_EQUAL(dest[-1], 'a'); \
+        ASSERT_EQUAL(dest[LEN], 'z'); \
+        for (int i = 0; i < LEN; ++i) { \
+            ASSERT_EQUAL(dest[i], src[i]); \
+        } \
+    }
+
+/* Off-by-half addresses use 16-bit units, 0x4000 for DMA0-2 and 0x10000 for DMA3 */
+DMA_QUEUE_SPLIT_TEST(14bit, 1, 0x8002)
+DMA_QUEUE_SPLIT_TEST(16bit, 3, 0x20002)
+
+#define VRAM_MEMCPY_TEST(OFFDST, OFFSRC, LEN) \
+    AGBTEST(memcpy, vram_##OFFDST##_##OFFSRC##_##LEN) { \
+        /* Character block 2 is not used by the test display */ \
+        char* dest = (char*) 0x6008000; \
+        for (int i = 0; i < LEN + 8; i += 2) { \
+            *(volatile unsigned short*) &dest[i] = (unsigned short) (('a' + (i % 26)) | (('a' + ((i + 1) % 26)) << 8)); \
+        } \
+        char src[LEN + 8] __attribute__((aligned(4))); \
+        fill_ascii_buffer(src, sizeof(src), 'A'); \
+        __agbabi_vram_memcpy(&dest[OFFDST], &src[OFFSRC], LEN); \
+        for (int i = 0; i < LEN + 8; ++i) { \
+            const char expected = (i < OFFDST || i >= OFFDST + LEN) ? (char) ('a' + (i % 26)) : src[i - OFFDST + OFFSRC]; \
+            ASSERT_EQUAL(dest[i], expected); \
+        } \
+    }
+
+/* An 8-bit write to VRAM duplicates the byte across its halfword and fails these */
+VRAM_MEMCPY_TEST(1, 0, 1)
+VRAM_MEMCPY_TEST(1, 0, 2)
+VRAM_MEMCPY_TEST(1, 1, 7)
+VRAM_MEMCPY_TEST(3, 0, 40)
+VRAM_MEMCPY_TEST(2, 1, 41)
+VRAM_MEMCPY_TEST(0, 3, 13)
+
+#define REGION_MEMCPY_TEST(NAME, DEST, FILL, OFFDST, OFFSRC, LEN) \
+    AGBTEST(memcpy, region_##NAME##_##OFFDST##_##OFFSRC##_##LEN) { \
+        volatile char* dest = (volatile char*) (DEST); \
+        char background[LEN + 8] __attribute__((aligned(4))); \
+        fill_ascii_buffer(background, sizeof(background), 'a'); \
+        FILL((char*) dest, background, sizeof(background)); \
+        char src[LEN + 8] __attribute__((aligned(4))); \
+        fill_ascii_buffer(src, sizeof(src), 'A'); \
+        __aeabi_memcpy((char*) &dest[OFFDST], &src[OFFSRC], LEN); \
+        for (int i = 0; i < LEN + 8; ++i) { \
+            const char expected = (i < OFFDST || i >= OFFDST + LEN) ? (char) ('a' + (i % 26)) : src[i - OFFDST + OFFSRC]; \
+            ASSERT_EQUAL(dest[i], expected); \
+        } \
+    }
+
+/* __aeabi_memcpy must route these away from 8-bit VRAM writes and wide SRAM accesses */
+REGION_MEMCPY_TEST(vram, 0x6008000, __agbabi_vram_memcpy, 1, 0, 7)
+REGION_MEMCPY_TEST(vram, 0x6008000, __agbabi_vram_memcpy, 0, 0, 40)
+REGION_MEMCPY_TEST(vram, 0x6008000, __agbabi_vram_memcpy, 3, 2, 41)
+REGION_MEMCPY_TEST(sram, 0xE000000, __agbabi_memcpy1, 0, 0, 40)
+REGION_MEMCPY_TEST(sram, 0xE000000, __agbabi_memcpy1, 1, 3, 13)
+
 void fill_ascii_buffer(void* buf, size_t len, char base) {
     char* b = (char*) buf;
     for (size_t i = 0; i < len; ++i) {
@@ -0,0 +1,53 @@
+#include <aeabi.h>
+#include <agbabi.h>
+
+#include "agbtest.h"
+
+static void fill_ascii_buffer(void* buf, size_t len, char base);
+
+#define MEMMOVE_TEST(OFFDST, OFFSRC, LEN) \
+    AGBTEST(memmove, offset_##OFFDST##_##OFFSRC##_##LEN) { \
+        char buf[LEN + 16] __attribute__((aligned(4))); \
+        fill_ascii_buffer(buf, sizeof(buf), 'a'); \
+        __aeabi_memmove(&buf[OFFDST], &buf[OFFSRC], LEN); \
+        for (int i = 0; i < (int) sizeof(buf); ++i) { \
+            const int j = (i < OFFDST || i >= OFFDST + LEN) ? i : i - OFFDST + OFFSRC; \
+            ASSERT_EQUAL(buf[i], (char) ('a' + (j % 26))); \
+        } \
+    }
+
+MEMMOVE_TEST(1, 0, 8)
+MEMMOVE_TEST(0, 1, 8)
+MEMMOVE_TEST(4, 0, 64)
+MEMMOVE_TEST(0, 4, 64)
+MEMMOVE_TEST(1, 0, 71)
+MEMMOVE_TEST(2, 0, 71)
+MEMMOVE_TEST(3, 0, 71)
+MEMMOVE_TEST(5, 2, 100)
+MEMMOVE_TEST(7, 2, 100)
+MEMMOVE_TEST(13, 0, 37)
+MEMMOVE_TEST(0, 13, 37)
+
+#define FIQ_MEMMOVE_TEST(OFFDST, OFFSRC, LEN) \
+    AGBTEST(memmove, fiq_##OFFDST##_##OFFSRC##_##LEN) { \
+        static char buf[LEN + 64] __attribute__((aligned(4))); \
+        fill_ascii_buffer(buf, sizeof(buf), 'a'); \
+        __agbabi_fiq_memmove4(&buf[OFFDST], &buf[OFFSRC], LEN); \
+        for (int i = 0; i < (int) sizeof(buf); ++i) { \
+            const int j = (i < OFFDST || i >= OFFDST + LEN) ? i : i - OFFDST + OFFSRC; \
+            ASSERT_EQUAL(buf[i], (char) ('a' + (j % 26))); \
+        } \
+    }
+
+FIQ_MEMMOVE_TEST(4, 0, 480)
+FIQ_MEMMOVE_TEST(0, 4, 480)
+FIQ_MEMMOVE_TEST(48, 0, 483)
+FIQ_MEMMOVE_TEST(0, 48, 483)
+FIQ_MEMMOVE_TEST(8, 0, 47)
+
+void fill_ascii_buffer(void* buf, size_t len, char base) {
+    char* b = (char*) buf;
+    for (size_t i = 0; i < len; ++i) {
+        b[i] = (char) (base + (i % 26));
+    }
+}
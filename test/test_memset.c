@@ -1,4 +1,5 @@
 #include <aeabi.h>
+#include <agbabi.h>
 
 #include "agbtest.h"
 
@@ -93,6 +94,81 @@ AGBTEST(memset, very_big_offset_1) {
     ASSERT_EQUAL(b[129], 'z');
 }
 
+AGBTEST(memset, dma_offset_1) {
+    static char b[1026];
+    fill_ascii_buffer(b, 1026, 'a');
+
+    __agbabi_dma_memset(&b[1], 1024, '?');
+    ASSERT_EQUAL(b[0], 'a');
+    for (int i = 1; i < 1025; ++i) {
+        ASSERT_EQUAL(b[i], '?');
+    }
+    ASSERT_EQUAL(b[1025], 'a' + (1025 % 26));
+}
+
+AGBTEST(memset, dma_vram_offset_1) {
+    /* Character block 2 is not used by the test display */
+    volatile unsigned short* vram = (volatile unsigned short*) 0x6008000;
+    for (int i = 0; i < 4098; ++i) {
+        vram[i] = 0xffff;
+    }
+
+    /* An 8-bit write of the odd head or tail byte would duplicate it across its halfword */
+    __agbabi_dma_memset((char*) vram + 1, 8192, 0xcd);
+    ASSERT_EQUAL(vram[0], 0xcdff);
+    for (int i = 1; i < 4096; ++i) {
+        ASSERT_EQUAL(vram[i], 0xcdcd);
+    }
+    ASSERT_EQUAL(vram[4096], 0xffcd);
+    ASSERT_EQUAL(vram[4097], 0xffff);
+
+    __agbabi_dma_memset((char*) vram + 3, 5, 0x12);
+    ASSERT_EQUAL(vram[1], 0x12cd);
+    ASSERT_EQUAL(vram[2], 0x1212);
+    ASSERT_EQUAL(vram[3], 0x1212);
+    ASSERT_EQUAL(vram[4], 0xcdcd);
+}
+
+AGBTEST(memset, vram_offset_1) {
+    /* Character block 2 is not used by the test display */
+    volatile unsigned short* vram = (volatile unsigned short*) 0x6008000;
+    for (int i = 0; i < 8; ++i) {
+        vram[i] = 0xffff;
+    }
+
+    /* An 8-bit write to VRAM duplicates the byte across its halfword and fails this */
+    __agbabi_vram_memset((char*) vram + 1, 13, 0xcd);
+    ASSERT_EQUAL(vram[0], 0xcdff);
+    for (int i = 1; i < 7; ++i) {
+        ASSERT_EQUAL(vram[i], 0xcdcd);
+    }
+    ASSERT_EQUAL(vram[7], 0xffff);
+}
+
+AGBTEST(memset, fiq_1024) {
+    static unsigned int b[258];
+    b[0] = 0xffffffff;
+    b[257] = 0xffffffff;
+
+    __agbabi_fiq_memset4(&b[1], 1024, 0xcd);
+    ASSERT_EQUAL(b[0], 0xffffffff);
+    for (int i = 1; i < 257; ++i) {
+        ASSERT_EQUAL(b[i], 0xcdcdcdcd);
+    }
+    ASSERT_EQUAL(b[257], 0xffffffff);
+}
+
+AGBTEST(memset, fiq_multiple_of_48) {
+    static unsigned int b[194];
+    b[193] = 0xffffffff;
+
+    __agbabi_fiq_wordset4(b, 768, 0x12345678);
+    ASSERT_EQUAL(b[0], 0x12345678);
+    ASSERT_EQUAL(b[191], 0x12345678);
+    ASSERT_EQUAL(b[192], 0);
+    ASSERT_EQUAL(b[193], 0xffffffff);
+}
+
 void fill_ascii_buffer(void* buf, size_t len, char base) {
     char* b = (char*) buf;
     for (size_t i = 0; i < len; ++i) {